@@ -0,0 +1,299 @@
+// CVFilterBench.cpp : Measures how much latency and jitter each way of smoothing CV hand data adds, by playing a CV
+// stream through FlatCVHandDataSmoother and querying it at 1 kHz, as a simulation would.
+//
+// Usage: cv-filter-bench [--recording <file>] [--left]
+//
+// A recording is a text file with one CV frame per line: its timestamp in seconds, followed by the x, y and z of all
+// 21 keypoints in ECVHandPoints order. Lines starting with # are ignored. Frames are converted into hand angles by
+// CVKinematicsBatch. Without a recording, a synthetic 90 Hz stream of alternating motion and stillness is generated,
+// with noise added on top.
+//
+// Latency is the delay, in ms, at which the output best matches the reference; jitter is the RMS difference that
+// remains at that delay. For synthetic streams, the reference is the noise-free motion. For recordings, it is the
+// unfiltered input itself, so jitter then also includes any noise a method lets through.
+//
+
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <SenseGlove/Core/CVHandDataSmoother.hpp>
+#include <SenseGlove/Core/CVHandFilter.hpp>
+#include <SenseGlove/Core/CVKinematicsBatch.hpp>
+#include <SenseGlove/Core/FlatCVHandData.hpp>
+#include <SenseGlove/Core/FlatCVHandDataSmoother.hpp>
+
+
+using namespace SGCore;
+using namespace SGCore::CV;
+
+static const float QueryRate = 1000.0f;
+static const float WarmupTime = 1.0f;
+static const uint32_t MaxLag = 200;// in queries, i.e. ms.
+
+/// <summary> Input frames, and the reference the output is compared against at every query. </summary>
+struct Stream
+{
+    std::vector<FlatCVHandData> Frames;
+    std::vector<FlatCVHandData> Reference;
+};
+
+/// <summary> A way of smoothing that is benchmarked. </summary>
+struct Method
+{
+    const char* Name;
+    ESmoothingMethod Smoothing;
+    ECVFilterMethod Filter;
+};
+
+//--------------------------------------------------------------------------------------
+// Input
+
+/// <summary> Noise-free synthetic motion: 4 seconds of moving, followed by 4 seconds of holding still. </summary>
+static FlatCVHandData CreateMotion(float time, float positionNoise, float angleNoise, std::mt19937& random)
+{
+    std::normal_distribution<float> positionJitter(0.0f, positionNoise > 0.0f ? positionNoise : 1.0f);
+    std::normal_distribution<float> angleJitter(0.0f, angleNoise > 0.0f ? angleNoise : 1.0f);
+    const float pNoise = positionNoise > 0.0f ? 1.0f : 0.0f;
+    const float aNoise = angleNoise > 0.0f ? 1.0f : 0.0f;
+    const float twoPi = 6.28318530718f;
+    const float moving = std::floor(time / 8.0f) * 4.0f + std::min(std::fmod(time, 8.0f), 4.0f);
+
+    FlatCVHandData data;
+    data.Clear();
+    data.bValid = true;
+    data.bRightHanded = true;
+    data.Timestamp = time;
+    data.GlobalCertainty = 1.0f;
+    data.WristPosition[0] = 100.0f * std::sin(twoPi * 0.3f * moving) + pNoise * positionJitter(random);
+    data.WristPosition[1] = 50.0f * std::cos(twoPi * 0.3f * moving) + pNoise * positionJitter(random);
+    data.WristPosition[2] = 300.0f + pNoise * positionJitter(random);
+    const float yaw = 0.5f * std::sin(twoPi * 0.25f * moving) + aNoise * angleJitter(random);
+    data.WristRotation[1] = std::sin(yaw * 0.5f);
+    data.WristRotation[3] = std::cos(yaw * 0.5f);
+    for (uint32_t f = 0; f < FlatCVHandData::MaxFingers; ++f) {
+        data.AngleCount[f] = 3;
+        for (uint32_t j = 0; j < 3; ++j) {
+            const float flexion = -0.8f + 0.7f * std::sin(twoPi * 0.5f * moving + static_cast<float>(f + j));
+            data.HandAngles[f][j][1] = aNoise * angleJitter(random);
+            data.HandAngles[f][j][2] = flexion + aNoise * angleJitter(random);
+        }
+    }
+    return data;
+}
+
+static Stream CreateSyntheticStream()
+{
+    const float duration = 20.0f;
+    const float frameRate = 90.0f;
+    std::mt19937 random(42);
+    Stream stream;
+    for (uint32_t i = 0; static_cast<float>(i) / frameRate < duration; ++i) {
+        stream.Frames.push_back(CreateMotion(static_cast<float>(i) / frameRate, 2.0f, 0.02f, random));
+    }
+    for (uint32_t i = 0; static_cast<float>(i) / QueryRate < duration; ++i) {
+        stream.Reference.push_back(CreateMotion(static_cast<float>(i) / QueryRate, 0.0f, 0.0f, random));
+    }
+    return stream;
+}
+
+static bool LoadRecording(const std::string& path, bool bRightHanded, Stream& out_stream)
+{
+    std::ifstream file(path);
+    if (!file.is_open()) {
+        return false;
+    }
+    std::vector<float> times;
+    std::vector<float> keypoints;
+    std::string line;
+    while (std::getline(file, line)) {
+        if (line.empty() || line[0] == '#') {
+            continue;
+        }
+        std::istringstream values(line);
+        float time = 0.0f;
+        std::vector<float> frame(CVKinematicsBatch::FloatsPerFrame);
+        values >> time;
+        for (float& value : frame) {
+            values >> value;
+        }
+        if (values.fail()) {
+            continue;
+        }
+        times.push_back(time);
+        keypoints.insert(keypoints.end(), frame.begin(), frame.end());
+    }
+
+    CVKinematicsBatch::Settings settings;
+    settings.bRightHanded = bRightHanded;
+    std::vector<CVKinematicsBatch::Result> results;
+    CVKinematicsBatch::Solve(keypoints, settings, results);
+    for (std::size_t i = 0; i < results.size(); ++i) {
+        if (results[i].bValid && (out_stream.Frames.empty() || times[i] > out_stream.Frames.back().Timestamp)) {
+            FlatCVHandData data;
+            data.CopyFrom(results[i], bRightHanded, times[i], 1.0f);
+            out_stream.Frames.push_back(data);
+        }
+    }
+    if (out_stream.Frames.size() < 2) {
+        return false;
+    }
+
+    // The unfiltered input, linearly interpolated at every query.
+    FlatCVHandDataSmoother raw(2, ESmoothingMethod::None);
+    std::size_t next = 0;
+    for (float time = out_stream.Frames.front().Timestamp; time < out_stream.Frames.back().Timestamp;
+         time += 1.0f / QueryRate) {
+        while (next < out_stream.Frames.size() && out_stream.Frames[next].Timestamp <= time) {
+            raw.AddFrame(out_stream.Frames[next++]);
+        }
+        FlatCVHandData reference;
+        const FlatCVHandData& upcoming = out_stream.Frames[next < out_stream.Frames.size() ? next : next - 1];
+        const float interval = upcoming.Timestamp - raw.GetFrame(0)->Timestamp;
+        const float t = interval > 0.0f ? (time - raw.GetFrame(0)->Timestamp) / interval : 1.0f;
+        FlatCVHandData::Interpolate(t, *raw.GetFrame(0), upcoming, true, reference);
+        out_stream.Reference.push_back(reference);
+    }
+    return true;
+}
+
+//--------------------------------------------------------------------------------------
+// Measurement
+
+/// <summary> Mean squared difference between output and the reference lag queries earlier, over the wrist position
+/// or over all hand angles. </summary>
+static double MeanSquaredError(const std::vector<FlatCVHandData>& output, const std::vector<FlatCVHandData>& reference,
+                               uint32_t lag, bool bAngles)
+{
+    double sum = 0.0;
+    uint64_t count = 0;
+    const uint32_t warmup = static_cast<uint32_t>(WarmupTime * QueryRate);
+    for (std::size_t i = warmup > lag ? warmup : lag; i < output.size() && i < reference.size(); ++i) {
+        const FlatCVHandData& actual = output[i];
+        const FlatCVHandData& expected = reference[i - lag];
+        if (!bAngles) {
+            for (uint32_t c = 0; c < 3; ++c) {
+                const double error = actual.WristPosition[c] - expected.WristPosition[c];
+                sum += error * error;
+                ++count;
+            }
+            continue;
+        }
+        for (uint32_t f = 0; f < FlatCVHandData::MaxFingers; ++f) {
+            for (uint32_t j = 0; j < expected.AngleCount[f]; ++j) {
+                for (uint32_t c = 0; c < 3; ++c) {
+                    const double error = actual.HandAngles[f][j][c] - expected.HandAngles[f][j][c];
+                    sum += error * error;
+                    ++count;
+                }
+            }
+        }
+    }
+    return count > 0 ? sum / static_cast<double>(count) : 0.0;
+}
+
+/// <summary> The lag, in queries, at which output matches the reference best, and the RMS error at that lag.
+/// </summary>
+static void FindLatency(const std::vector<FlatCVHandData>& output, const std::vector<FlatCVHandData>& reference,
+                        bool bAngles, uint32_t& out_lag, double& out_rms)
+{
+    out_lag = 0;
+    double best = MeanSquaredError(output, reference, 0, bAngles);
+    for (uint32_t lag = 1; lag <= MaxLag; ++lag) {
+        const double error = MeanSquaredError(output, reference, lag, bAngles);
+        if (error < best) {
+            best = error;
+            out_lag = lag;
+        }
+    }
+    out_rms = std::sqrt(best);
+}
+
+static void RunMethod(const Method& method, const Stream& stream)
+{
+    FlatCVHandDataSmoother smoother(FlatCVHandDataSmoother::DefaultDepth, method.Smoothing);
+    smoother.SetFilterMethod(method.Filter);
+
+    std::vector<FlatCVHandData> output(stream.Reference.size());
+    const float start = stream.Frames.front().Timestamp;
+    std::size_t next = 0;
+    std::chrono::steady_clock::duration elapsed(0);
+    for (std::size_t i = 0; i < output.size(); ++i) {
+        const float time = start + static_cast<float>(i) / QueryRate;
+        const std::chrono::steady_clock::time_point before = std::chrono::steady_clock::now();
+        while (next < stream.Frames.size() && stream.Frames[next].Timestamp <= time) {
+            smoother.AddFrame(stream.Frames[next++]);
+        }
+        smoother.GetSmoothedPose(time, output[i]);
+        elapsed += std::chrono::steady_clock::now() - before;
+    }
+
+    uint32_t angleLag = 0;
+    uint32_t positionLag = 0;
+    double angleRms = 0.0;
+    double positionRms = 0.0;
+    FindLatency(output, stream.Reference, true, angleLag, angleRms);
+    FindLatency(output, stream.Reference, false, positionLag, positionRms);
+    const double nsPerQuery = std::chrono::duration<double, std::nano>(elapsed).count()
+                              / static_cast<double>(output.size());
+
+    std::cout << std::left << std::setw(28) << method.Name << std::right << std::fixed
+              << std::setw(10) << std::setprecision(0) << angleLag
+              << std::setw(12) << std::setprecision(4) << angleRms
+              << std::setw(10) << std::setprecision(0) << positionLag
+              << std::setw(12) << std::setprecision(2) << positionRms
+              << std::setw(12) << std::setprecision(0) << nsPerQuery << std::endl;
+}
+
+int main(int argc, char** argv)
+{
+    std::string recordingPath;
+    bool bRightHanded = true;
+    for (int i = 1; i < argc; ++i) {
+        const std::string argument = argv[i];
+        if (argument == "--recording" && i + 1 < argc) {
+            recordingPath = argv[++i];
+        } else if (argument == "--left") {
+            bRightHanded = false;
+        } else {
+            std::cerr << "Usage: cv-filter-bench [--recording <file>] [--left]" << std::endl;
+            return 1;
+        }
+    }
+
+    Stream stream;
+    if (recordingPath.empty()) {
+        stream = CreateSyntheticStream();
+        std::cout << "Synthetic 90 Hz stream, " << stream.Frames.size() << " frames." << std::endl;
+    } else if (LoadRecording(recordingPath, bRightHanded, stream)) {
+        std::cout << "Recording " << recordingPath << ", " << stream.Frames.size() << " frames." << std::endl;
+    } else {
+        std::cerr << "Could not load at least two valid frames from " << recordingPath << std::endl;
+        return 1;
+    }
+
+    const Method methods[] = {
+            {"None", ESmoothingMethod::None, ECVFilterMethod::None},
+            {"InterpolateBehind", ESmoothingMethod::InterpolateBehind, ECVFilterMethod::None},
+            {"ExtrapolateAhead", ESmoothingMethod::ExtrapolateAhead, ECVFilterMethod::None},
+            {"OneEuro", ESmoothingMethod::None, ECVFilterMethod::OneEuro},
+            {"Kalman", ESmoothingMethod::None, ECVFilterMethod::Kalman},
+            {"OneEuro + InterpolateBehind", ESmoothingMethod::InterpolateBehind, ECVFilterMethod::OneEuro},
+    };
+
+    std::cout << std::left << std::setw(28) << "Method" << std::right
+              << std::setw(10) << "lag (ms)" << std::setw(12) << "angle rms"
+              << std::setw(10) << "lag (ms)" << std::setw(12) << "wrist rms" << std::setw(12) << "ns/query"
+              << std::endl;
+    for (const Method& method : methods) {
+        RunMethod(method, stream);
+    }
+    return 0;
+}
@@ -0,0 +1,231 @@
+// JointKinematicsBench.cpp : Compares JointKinematics::ForwardKinematics against the batched JointKinematicsBatch
+// kernel, both in accuracy and in speed, and checks the batched hand poses against HandPose::FromHandAngles, also for
+// the default geometry of Kinematics::GetFlatHandPose and for HandPosePredictor. Exits with 1 if any of the results
+// differ beyond tolerance.
+// Build with -O2 (and -mavx2 to try the AVX2 path).
+//
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include <SenseGlove/Core/BasicHandModel.hpp>
+#include <SenseGlove/Core/FlatHandPose.hpp>
+#include <SenseGlove/Core/Fingers.hpp>
+#include <SenseGlove/Core/GloveKinematics.hpp>
+#include <SenseGlove/Core/HandPose.hpp>
+#include <SenseGlove/Core/HandPosePredictor.hpp>
+#include <SenseGlove/Core/JointKinematics.hpp>
+#include <SenseGlove/Core/JointKinematicsBatch.hpp>
+#include <SenseGlove/Core/Quat.hpp>
+#include <SenseGlove/Core/Vect3D.hpp>
+
+
+using namespace SGCore;
+using namespace SGCore::Kinematics;
+
+static const uint32_t HandCount = 1024;
+static const uint32_t Iterations = 20;
+
+/// <summary> Random but plausible hand angles: flexion on the z-axis, a little abduction on the y-axis. </summary>
+static std::vector<FlatHandPose> CreateRandomAngles(uint32_t count)
+{
+    std::mt19937 random(42);
+    std::uniform_real_distribution<float> flexion(-1.6f, 0.2f);
+    std::uniform_real_distribution<float> abduction(-0.4f, 0.4f);
+    std::vector<FlatHandPose> poses(count);
+    for (FlatHandPose& pose : poses) {
+        pose.Clear();
+        for (uint32_t f = 0; f < FlatHandPose::MaxFingers; ++f) {
+            pose.AngleCount[f] = 3;
+            for (uint32_t j = 0; j < 3; ++j) {
+                pose.HandAngles[f][j][0] = f == 0 ? abduction(random) : 0.0f;
+                pose.HandAngles[f][j][1] = j == 0 ? abduction(random) : 0.0f;
+                pose.HandAngles[f][j][2] = flexion(random);
+            }
+        }
+    }
+    return poses;
+}
+
+/// <summary> The hand angles of a flat pose, in the form HandPose::FromHandAngles takes. </summary>
+static std::vector<std::vector<Vect3D>> ToHandAngles(const FlatHandPose& pose)
+{
+    std::vector<std::vector<Vect3D>> handAngles(FlatHandPose::MaxFingers);
+    for (uint32_t f = 0; f < FlatHandPose::MaxFingers; ++f) {
+        for (uint32_t j = 0; j < pose.AngleCount[f]; ++j) {
+            handAngles[f].emplace_back(pose.HandAngles[f][j][0], pose.HandAngles[f][j][1], pose.HandAngles[f][j][2]);
+        }
+    }
+    return handAngles;
+}
+
+/// <summary> Grow the max position- and rotation errors by the differences between the joints of two flat poses.
+/// A different amount of joints counts as an infinite position error. </summary>
+static void AddPoseErrors(const FlatHandPose& expected, const FlatHandPose& actual, float& out_maxPositionError,
+                          float& out_maxRotationError)
+{
+    for (uint32_t f = 0; f < FlatHandPose::MaxFingers; ++f) {
+        if (expected.JointCount[f] != actual.JointCount[f]) {
+            out_maxPositionError = HUGE_VALF;
+        }
+        for (uint32_t j = 0; j < expected.JointCount[f] && j < actual.JointCount[f]; ++j) {
+            for (uint32_t i = 0; i < 3; ++i) {
+                const float error = std::fabs(expected.JointPositions[f][j][i] - actual.JointPositions[f][j][i]);
+                out_maxPositionError = std::max(out_maxPositionError, error);
+            }
+            for (uint32_t i = 0; i < 4; ++i) {
+                const float error = std::fabs(expected.JointRotations[f][j][i] - actual.JointRotations[f][j][i]);
+                out_maxRotationError = std::max(out_maxRotationError, error);
+            }
+        }
+    }
+}
+
+int main()
+{
+    const BasicHandModel profile = BasicHandModel::Default(true);
+    const JointKinematicsBatch::HandGeometry geometry = JointKinematicsBatch::HandGeometry::FromModel(profile);
+    const std::vector<FlatHandPose> angles = CreateRandomAngles(HandCount);
+
+    // Reference: one finger at a time, through the existing API.
+    std::vector<std::vector<Vect3D>> fingerAngles(FlatHandPose::MaxFingers * HandCount);
+    for (uint32_t h = 0; h < HandCount; ++h) {
+        for (uint32_t f = 0; f < FlatHandPose::MaxFingers; ++f) {
+            std::vector<Vect3D>& joints = fingerAngles[h * FlatHandPose::MaxFingers + f];
+            for (uint32_t j = 0; j < geometry.JointCount[f]; ++j) {
+                const bool bHasAngle = j < angles[h].AngleCount[f];
+                joints.emplace_back(bHasAngle ? angles[h].HandAngles[f][j][0] : 0.0f,
+                                    bHasAngle ? angles[h].HandAngles[f][j][1] : 0.0f,
+                                    bHasAngle ? angles[h].HandAngles[f][j][2] : 0.0f);
+            }
+        }
+    }
+    std::vector<std::vector<Vect3D>> lengths(FlatHandPose::MaxFingers);
+    for (uint32_t f = 0; f < FlatHandPose::MaxFingers; ++f) {
+        lengths[f] = profile.Get3DLengths(static_cast<EFinger>(f));
+        lengths[f].emplace_back(0.0f, 0.0f, 0.0f);// the fingertip has no length after it.
+    }
+
+    // The same start of each chain as the batch, which includes the thumb correction of HandPose::FromHandAngles.
+    std::vector<Vect3D> startPositions;
+    std::vector<Quat> startRotations;
+    for (uint32_t f = 0; f < FlatHandPose::MaxFingers; ++f) {
+        startPositions.emplace_back(geometry.StartPositions[f][0], geometry.StartPositions[f][1],
+                                    geometry.StartPositions[f][2]);
+        startRotations.emplace_back(geometry.StartRotations[f][0], geometry.StartRotations[f][1],
+                                    geometry.StartRotations[f][2], geometry.StartRotations[f][3]);
+    }
+
+    std::vector<std::vector<Vect3D>> referencePositions(fingerAngles.size());
+    std::vector<std::vector<Quat>> referenceRotations(fingerAngles.size());
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < Iterations; ++i) {
+        for (uint32_t h = 0; h < HandCount; ++h) {
+            for (uint32_t f = 0; f < FlatHandPose::MaxFingers; ++f) {
+                const uint32_t c = h * FlatHandPose::MaxFingers + f;
+                JointKinematics::ForwardKinematics(startPositions[f], startRotations[f], lengths[f], fingerAngles[c],
+                                                   referencePositions[c], referenceRotations[c]);
+            }
+        }
+    }
+    const double referenceNs = std::chrono::duration<double, std::nano>(
+            std::chrono::steady_clock::now() - start).count() / (Iterations * HandCount);
+
+    // Batched: all fingers of all hands at once.
+    std::vector<FlatHandPose> batched(HandCount);
+    start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < Iterations; ++i) {
+        JointKinematicsBatch::ForwardKinematics(geometry, angles.data(), batched.data(), HandCount);
+    }
+    const double batchedNs = std::chrono::duration<double, std::nano>(
+            std::chrono::steady_clock::now() - start).count() / (Iterations * HandCount);
+
+    float maxPositionError = 0.0f;
+    float maxRotationError = 0.0f;
+    for (uint32_t h = 0; h < HandCount; ++h) {
+        for (uint32_t f = 0; f < FlatHandPose::MaxFingers; ++f) {
+            const uint32_t c = h * FlatHandPose::MaxFingers + f;
+            for (uint32_t j = 0; j < batched[h].JointCount[f] && j < referencePositions[c].size(); ++j) {
+                const Vect3D& position = referencePositions[c][j];
+                const Quat& rotation = referenceRotations[c][j];
+                const float* flatPosition = batched[h].JointPositions[f][j];
+                const float* flatRotation = batched[h].JointRotations[f][j];
+                maxPositionError = std::max({maxPositionError, std::fabs(position.GetX() - flatPosition[0]),
+                                             std::fabs(position.GetY() - flatPosition[1]),
+                                             std::fabs(position.GetZ() - flatPosition[2])});
+                maxRotationError = std::max({maxRotationError, std::fabs(rotation.GetX() - flatRotation[0]),
+                                             std::fabs(rotation.GetY() - flatRotation[1]),
+                                             std::fabs(rotation.GetZ() - flatRotation[2]),
+                                             std::fabs(rotation.GetW() - flatRotation[3])});
+            }
+        }
+    }
+
+    // The poses the library itself calculates from the same hand angles, e.g. for HapticGlove::GetHandPose.
+    float maxPosePositionError = 0.0f;
+    float maxPoseRotationError = 0.0f;
+    FlatHandPose pose;
+    for (uint32_t h = 0; h < HandCount; ++h) {
+        pose.CopyFrom(HandPose::FromHandAngles(ToHandAngles(angles[h]), true, profile));
+        AddPoseErrors(pose, batched[h], maxPosePositionError, maxPoseRotationError);
+    }
+
+    // The default geometry of both hands, as used by Kinematics::GetFlatHandPose, against the default HandPose.
+    float maxDefaultPositionError = 0.0f;
+    float maxDefaultRotationError = 0.0f;
+    FlatHandPose flatPose;
+    for (uint32_t h = 0; h < HandCount; h += 16) {
+        for (bool bRight : {false, true}) {
+            JointKinematicsBatch::ForwardKinematics(GetDefaultHandGeometry(bRight), angles[h], flatPose);
+            pose.CopyFrom(HandPose::FromHandAngles(ToHandAngles(angles[h]), bRight));
+            AddPoseErrors(pose, flatPose, maxDefaultPositionError, maxDefaultRotationError);
+        }
+    }
+
+    // Predicted poses, for the geometry set on the predictor and for the default one.
+    float maxPredictedPositionError = 0.0f;
+    float maxPredictedRotationError = 0.0f;
+    for (bool bSetGeometry : {true, false}) {
+        HandPosePredictor predictor;
+        if (bSetGeometry) {
+            predictor.SetHandGeometry(profile);
+        }
+        for (uint32_t h = 0; h < 4; ++h) {
+            FlatHandPose sample = angles[h];
+            sample.bValid = true;
+            sample.bRightHanded = true;
+            predictor.AddSample(sample, (h + 1) * 10000000ULL);
+        }
+        FlatHandPose predicted;
+        predictor.Predict(45000000ULL, predicted);
+        pose.CopyFrom(bSetGeometry ? HandPose::FromHandAngles(ToHandAngles(predicted), true, profile)
+                                   : HandPose::FromHandAngles(ToHandAngles(predicted), true));
+        AddPoseErrors(pose, predicted, maxPredictedPositionError, maxPredictedRotationError);
+    }
+
+    std::cout << "JointKinematics::ForwardKinematics : " << referenceNs << " ns / hand" << std::endl;
+    std::cout << "JointKinematicsBatch (" << JointKinematicsBatch::GetSimdName() << ", "
+              << JointKinematicsBatch::GetLaneWidth() << " lanes) : " << batchedNs << " ns / hand" << std::endl;
+    std::cout << "Speedup : " << referenceNs / batchedNs << "x" << std::endl;
+    std::cout << "Max position error : " << maxPositionError << " mm" << std::endl;
+    std::cout << "Max rotation error : " << maxRotationError << std::endl;
+    std::cout << "Max position error vs HandPose::FromHandAngles : " << maxPosePositionError << " mm" << std::endl;
+    std::cout << "Max rotation error vs HandPose::FromHandAngles : " << maxPoseRotationError << std::endl;
+    std::cout << "Max position error of the default geometry : " << maxDefaultPositionError << " mm" << std::endl;
+    std::cout << "Max rotation error of the default geometry : " << maxDefaultRotationError << std::endl;
+    std::cout << "Max position error of HandPosePredictor : " << maxPredictedPositionError << " mm" << std::endl;
+    std::cout << "Max rotation error of HandPosePredictor : " << maxPredictedRotationError << std::endl;
+
+    const bool bWithinTolerance = maxPositionError < 0.01f && maxRotationError < 1e-4f
+                                  && maxPosePositionError < 0.01f && maxPoseRotationError < 1e-4f
+                                  && maxDefaultPositionError < 0.01f && maxDefaultRotationError < 1e-4f
+                                  && maxPredictedPositionError < 0.01f && maxPredictedRotationError < 1e-4f;
+    std::cout << (bWithinTolerance ? "Results match within tolerance." : "Results DIFFER beyond tolerance!")
+              << std::endl;
+    return bWithinTolerance ? 0 : 1;
+}
@@ -0,0 +1,605 @@
+// SGCoreBench.cpp : Microbenchmarks for the SGCore hot paths. Runs without hardware or SenseCom, and reports the time
+// and amount of heap allocations per operation, so regressions can be caught before upgrading SGCore.
+//
+// Usage: sgcore-bench [--recording <file>] [--iterations <n>] [--filter <text>]
+//
+// Parse benchmarks run on raw sensor strings generated in-process, in the layout SenseCom receives from each glove
+// type, so their numbers are always produced. To benchmark real data instead, pass a recording with raw sensor strings,
+// one per line, prefixed by their type and a single space:
+//
+//     nova2.info <constants string of a Nova 2.0>
+//     nova2 <raw sensor string of a Nova 2.0>
+//     nova.info <constants string of a Nova 1.0>
+//     nova <raw sensor string of a Nova 1.0>
+//     senseglove.info <constants string of a SenseGlove DK1>
+//     senseglove <raw sensor string of a SenseGlove DK1>
+//
+// Lines starting with # are ignored. Glove types without both info and samples in the recording use generated samples.
+//
+// Benchmarks of code paths that must not allocate are checked as well: if one of them allocates, it is reported as
+// FAILED and sgcore-bench exits with 1.
+//
+// Allocations are counted by replacing the global operator new. On Windows, the SGCore DLL uses its own allocator, so
+// allocations made inside the library are only counted on Linux and Android.
+//
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <new>
+#include <string>
+#include <vector>
+
+#include <SenseGlove/Core/BasicHandModel.hpp>
+#include <SenseGlove/Core/Communications.hpp>
+#include <SenseGlove/Core/CustomWaveform.hpp>
+#include <SenseGlove/Core/HandInterpolator.hpp>
+#include <SenseGlove/Core/HandPose.hpp>
+#include <SenseGlove/Core/HapticCommandBuffer.hpp>
+#include <SenseGlove/Core/Nova2GloveSensorData.hpp>
+#include <SenseGlove/Core/NovaGloveHapticEncoder.hpp>
+#include <SenseGlove/Core/NovaGloveInfo.hpp>
+#include <SenseGlove/Core/NovaGloveSensorData.hpp>
+#include <SenseGlove/Core/Quat.hpp>
+#include <SenseGlove/Core/SenseGloveInfo.hpp>
+#include <SenseGlove/Core/SenseGloveSensorData.hpp>
+#include <SenseGlove/Core/SensorNormalization.hpp>
+#include <SenseGlove/Core/Serializer.hpp>
+#include <SenseGlove/Core/StringViewUtils.hpp>
+#include <SenseGlove/Core/Vect3D.hpp>
+
+
+using namespace SGCore;
+using namespace SGCore::Kinematics;
+
+//--------------------------------------------------------------------------------------
+// Allocation counting
+
+static std::atomic<uint64_t> AllocationCount{0};
+
+void* operator new(std::size_t size)
+{
+    AllocationCount.fetch_add(1, std::memory_order_relaxed);
+    if (void* memory = std::malloc(size != 0 ? size : 1)) {
+        return memory;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size)
+{
+    return operator new(size);
+}
+
+void operator delete(void* memory) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete[](void* memory) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete(void* memory, std::size_t) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete[](void* memory, std::size_t) noexcept
+{
+    std::free(memory);
+}
+
+//--------------------------------------------------------------------------------------
+// Harness
+
+/// <summary> Results are accumulated here, so the compiler cannot optimize the benchmarked calls away. </summary>
+static volatile std::size_t Sink = 0;
+
+/// <summary> Amount of checks that failed, e.g. zero-allocation benchmarks that did allocate. </summary>
+static uint32_t FailedChecks = 0;
+
+struct BenchSettings
+{
+    uint32_t Iterations = 20000;
+    std::string Filter;
+};
+
+/// <summary> Run operation iterations times (after a short warm-up), and print ns/op and allocations/op. Returns
+/// the amount of allocations made outside of the warm-up. </summary>
+static uint64_t Run(const BenchSettings& settings, const std::string& name,
+                    const std::function<void(uint32_t)>& operation)
+{
+    if (!settings.Filter.empty() && name.find(settings.Filter) == std::string::npos) {
+        return 0;
+    }
+    const uint32_t warmUp = settings.Iterations / 10 + 1;
+    for (uint32_t i = 0; i < warmUp; ++i) {
+        operation(i);
+    }
+
+    const uint64_t allocationsBefore = AllocationCount.load(std::memory_order_relaxed);
+    const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < settings.Iterations; ++i) {
+        operation(i);
+    }
+    const double elapsedNs = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    const uint64_t allocations = AllocationCount.load(std::memory_order_relaxed) - allocationsBefore;
+
+    std::cout << std::left << std::setw(48) << name << std::right << std::fixed
+              << std::setw(12) << std::setprecision(1) << elapsedNs / settings.Iterations << " ns/op"
+              << std::setw(10) << std::setprecision(2) << static_cast<double>(allocations) / settings.Iterations
+              << " allocs/op" << std::endl;
+    return allocations;
+}
+
+/// <summary> As Run, but operation must not allocate once warmed up. </summary>
+static void RunZeroAllocation(const BenchSettings& settings, const std::string& name,
+                              const std::function<void(uint32_t)>& operation)
+{
+    if (Run(settings, name, operation) > 0) {
+        std::cout << "FAILED: " << name << " allocates." << std::endl;
+        ++FailedChecks;
+    }
+}
+
+//--------------------------------------------------------------------------------------
+// Recordings
+
+struct Recording
+{
+    std::string Nova2Info;
+    std::vector<std::string> Nova2Samples;
+    std::string NovaInfo;
+    std::vector<std::string> NovaSamples;
+    std::string SenseGloveInfo;
+    std::vector<std::string> SenseGloveSamples;
+};
+
+static bool LoadRecording(const std::string& path, Recording& out_recording)
+{
+    std::ifstream file(path);
+    if (!file.is_open()) {
+        return false;
+    }
+    std::string line;
+    while (std::getline(file, line)) {
+        if (!line.empty() && line.back() == '\r') {
+            line.pop_back();
+        }
+        const std::size_t split = line.find(' ');
+        if (line.empty() || line[0] == '#' || split == std::string::npos) {
+            continue;
+        }
+        const std::string type = line.substr(0, split);
+        std::string payload = line.substr(split + 1);
+        if (type == "nova2.info") {
+            out_recording.Nova2Info = payload;
+        } else if (type == "nova2") {
+            out_recording.Nova2Samples.push_back(payload);
+        } else if (type == "nova.info") {
+            out_recording.NovaInfo = payload;
+        } else if (type == "nova") {
+            out_recording.NovaSamples.push_back(payload);
+        } else if (type == "senseglove.info") {
+            out_recording.SenseGloveInfo = payload;
+        } else if (type == "senseglove") {
+            out_recording.SenseGloveSamples.push_back(payload);
+        }
+    }
+    return true;
+}
+
+//--------------------------------------------------------------------------------------
+// Generated samples
+
+/// <summary> Amount of raw sensor strings generated per glove type when the recording has none. </summary>
+static const uint32_t GeneratedSampleCount = 64;
+
+/// <summary> Append rows x columns sensor values, separated by the row- and column delimiters. Values sweep through
+/// [0, maxValue] over the samples, and differ per sensor, like a hand opening and closing. </summary>
+static void AppendSensorValues(uint32_t sample, uint32_t rows, uint32_t columns, float maxValue, std::string& out_raw)
+{
+    for (uint32_t r = 0; r < rows; ++r) {
+        if (r > 0) {
+            out_raw.push_back(Util::Communications::GetRowDelimiter());
+        }
+        for (uint32_t c = 0; c < columns; ++c) {
+            if (c > 0) {
+                out_raw.push_back(Util::Communications::GetColumnDelimiter());
+            }
+            const uint32_t step = (sample * 7 + r * 5 + c * 3) % 100;
+            out_raw.append(std::to_string(maxValue * static_cast<float>(step) / 100.0f));
+        }
+    }
+}
+
+/// <summary> Append the IMU rotation of a raw sensor string: an identity quaternion, as x;y;z;w. </summary>
+static void AppendImuRotation(std::string& out_raw)
+{
+    const char column = Util::Communications::GetColumnDelimiter();
+    out_raw.append({'0', column, '0', column, '0', column, '1'});
+}
+
+/// <summary> Raw sensor strings of a Nova 1.0 or 2.0 with 5 sensors: per finger, a row of 3 sensor values; then the IMU
+/// rotation; then the battery level and whether the glove is charging. </summary>
+static std::vector<std::string> GenerateNovaSamples()
+{
+    const char section = Util::Communications::GetSectionDelimiter();
+    std::vector<std::string> samples;
+    for (uint32_t i = 0; i < GeneratedSampleCount; ++i) {
+        std::string raw;
+        AppendSensorValues(i, 5, 3, 1.0f, raw);
+        raw.push_back(section);
+        AppendImuRotation(raw);
+        raw.push_back(section);
+        raw.append({'1', '0', '0', Util::Communications::GetColumnDelimiter(), '0'});
+        samples.push_back(raw);
+    }
+    return samples;
+}
+
+/// <summary> Raw sensor strings of a SenseGlove DK1: a section the parser skips; per finger, a row of 4 sensor angles
+/// in radians; then the IMU rotation. </summary>
+static std::vector<std::string> GenerateSenseGloveSamples()
+{
+    const char section = Util::Communications::GetSectionDelimiter();
+    std::vector<std::string> samples;
+    for (uint32_t i = 0; i < GeneratedSampleCount; ++i) {
+        std::string raw = std::to_string(i);
+        raw.push_back(section);
+        AppendSensorValues(i, 5, 4, 1.5f, raw);
+        raw.push_back(section);
+        AppendImuRotation(raw);
+        samples.push_back(raw);
+    }
+    return samples;
+}
+
+/// <summary> Device info of a right-handed Nova with 5 sensors, to parse generated samples with. </summary>
+static Nova::NovaGloveInfo GenerateNovaInfo(int32_t firmwareVersion)
+{
+    return Nova::NovaGloveInfo("NOVA-BENCH-R", "v" + std::to_string(firmwareVersion) + ".0", firmwareVersion, 0, true,
+                               Quat::Identity(), 5);
+}
+
+/// <summary> Parsing a sample must yield values; otherwise its numbers say nothing. </summary>
+static void CheckParsedValues(const std::string& name, int32_t parsedValues)
+{
+    if (parsedValues <= 0) {
+        std::cout << "FAILED: " << name << " parses no values from its samples." << std::endl;
+        ++FailedChecks;
+    }
+}
+
+/// <summary> Print how many allocations parsing a single Nova 2.0 packet makes beyond those of the output object.
+/// Copying the parsed object allocates exactly its own storage; the rest is spent on intermediate strings and
+/// vectors. </summary>
+static void ReportNova2ParseAllocations(const BenchSettings& settings, const std::vector<std::string>& samples,
+                                        const Nova::NovaGloveInfo& info)
+{
+    const std::string name = "Nova2GloveSensorData::Parse allocations/packet";
+    if (!settings.Filter.empty() && name.find(settings.Filter) == std::string::npos) {
+        return;
+    }
+    const Nova::Nova2GloveSensorData warmUp = Nova::Nova2GloveSensorData::Parse(samples[0], info);
+    Sink = Sink + static_cast<std::size_t>(warmUp.GetParsedValues());
+
+    const uint64_t beforeParse = AllocationCount.load(std::memory_order_relaxed);
+    const Nova::Nova2GloveSensorData data = Nova::Nova2GloveSensorData::Parse(samples[1 % samples.size()], info);
+    const uint64_t parseAllocations = AllocationCount.load(std::memory_order_relaxed) - beforeParse;
+
+    const uint64_t beforeCopy = AllocationCount.load(std::memory_order_relaxed);
+    const Nova::Nova2GloveSensorData copy(data);
+    const uint64_t outputAllocations = AllocationCount.load(std::memory_order_relaxed) - beforeCopy;
+    Sink = Sink + static_cast<std::size_t>(copy.GetParsedValues());
+
+    const uint64_t extraAllocations = parseAllocations > outputAllocations ? parseAllocations - outputAllocations : 0;
+    std::cout << std::left << std::setw(48) << name << std::right << parseAllocations << " total, "
+              << outputAllocations << " for the output object, " << extraAllocations << " beyond it" << std::endl;
+}
+
+//--------------------------------------------------------------------------------------
+// Benchmarks
+
+static void BenchParse(const BenchSettings& settings, const Recording& recording)
+{
+    Nova::NovaGloveInfo nova2Info;
+    std::vector<std::string> nova2Samples = recording.Nova2Samples;
+    std::string source = " (recorded)";
+    if (nova2Samples.empty() || !Nova::NovaGloveInfo::Parse(recording.Nova2Info, nova2Info)) {
+        nova2Info = GenerateNovaInfo(2);
+        nova2Samples = GenerateNovaSamples();
+        source = " (generated)";
+    }
+    CheckParsedValues("Nova2GloveSensorData::Parse",
+                      Nova::Nova2GloveSensorData::Parse(nova2Samples[0], nova2Info).GetParsedValues());
+    Run(settings, "Nova2GloveSensorData::Parse" + source, [&](uint32_t i) {
+        const Nova::Nova2GloveSensorData data = Nova::Nova2GloveSensorData::Parse(nova2Samples[i % nova2Samples.size()],
+                                                                                nova2Info);
+        Sink = Sink + static_cast<std::size_t>(data.GetParsedValues());
+    });
+    ReportNova2ParseAllocations(settings, nova2Samples, nova2Info);
+
+    Nova::NovaGloveInfo novaInfo;
+    std::vector<std::string> novaSamples = recording.NovaSamples;
+    source = " (recorded)";
+    if (novaSamples.empty() || !Nova::NovaGloveInfo::Parse(recording.NovaInfo, novaInfo)) {
+        novaInfo = GenerateNovaInfo(1);
+        novaSamples = GenerateNovaSamples();
+        source = " (generated)";
+    }
+    CheckParsedValues("NovaGloveSensorData::Parse",
+                      Nova::NovaGloveSensorData::Parse(novaSamples[0], novaInfo).GetParsedValues());
+    Run(settings, "NovaGloveSensorData::Parse" + source, [&](uint32_t i) {
+        const Nova::NovaGloveSensorData data = Nova::NovaGloveSensorData::Parse(novaSamples[i % novaSamples.size()],
+                                                                              novaInfo);
+        Sink = Sink + static_cast<std::size_t>(data.GetParsedValues());
+    });
+
+    SG::SenseGloveInfo senseGloveInfo;
+    std::vector<std::string> senseGloveSamples = recording.SenseGloveSamples;
+    source = " (recorded)";
+    if (senseGloveSamples.empty() || !SG::SenseGloveInfo::Parse(recording.SenseGloveInfo, senseGloveInfo)) {
+        senseGloveInfo = SG::SenseGloveInfo();
+        senseGloveSamples = GenerateSenseGloveSamples();
+        source = " (generated)";
+    }
+    CheckParsedValues("SenseGloveSensorData::Parse",
+                      SG::SenseGloveSensorData::Parse(senseGloveSamples[0], senseGloveInfo).GetParsedValues());
+    Run(settings, "SenseGloveSensorData::Parse" + source, [&](uint32_t i) {
+        const SG::SenseGloveSensorData data = SG::SenseGloveSensorData::Parse(
+            senseGloveSamples[i % senseGloveSamples.size()], senseGloveInfo);
+        Sink = Sink + static_cast<std::size_t>(data.GetParsedValues());
+    });
+}
+
+static void BenchKinematics(const BenchSettings& settings)
+{
+    // A Nova 2.0 reports 5 flexions and 5 abductions; normalize 10 values swinging through their range.
+    Util::SensorNormalization normalization(std::vector<float>(10, 1000.0f));
+    std::vector<float> rawValues(10, 0.0f);
+    Run(settings, "SensorNormalization::NormalizeValues", [&](uint32_t i) {
+        for (std::size_t v = 0; v < rawValues.size(); ++v) {
+            rawValues[v] = static_cast<float>((i * 7 + v * 13) % 1000);
+        }
+        Sink = Sink + normalization.NormalizeValues(rawValues).size();
+    });
+
+    const HandInterpolator interpolator(true);
+    std::vector<std::vector<float>> flexions(5, std::vector<float>(3, 0.0f));
+    std::vector<float> abductions(5, 0.0f);
+    Run(settings, "HandInterpolator::InterpolateHandAngles", [&](uint32_t i) {
+        const float flexion = static_cast<float>(i % 100) / 100.0f;
+        for (std::vector<float>& finger : flexions) {
+            for (float& value : finger) {
+                value = flexion;
+            }
+        }
+        Sink = Sink + interpolator.InterpolateHandAngles(flexions, abductions, 0.0f).size();
+    });
+
+    const BasicHandModel handModel = BasicHandModel::Default(true);
+    const std::vector<std::vector<Vect3D>> handAngles = HandPose::DefaultIdle(true, handModel).GetHandAngles();
+    Run(settings, "HandPose::FromHandAngles", [&](uint32_t) {
+        const HandPose pose = HandPose::FromHandAngles(handAngles, true, handModel);
+        Sink = Sink + pose.GetHandAngles().size();
+    });
+}
+
+static void BenchSerializer(const BenchSettings& settings)
+{
+    const BasicHandModel handModel = BasicHandModel::Default(true);
+    const HandPose pose = HandPose::DefaultIdle(true, handModel);
+
+    Run(settings, "HandPose Serialize + Deserialize", [&](uint32_t) {
+        const HandPose copy = HandPose::Deserialize(pose.Serialize());
+        Sink = Sink + copy.GetHandAngles().size();
+    });
+
+    Run(settings, "BasicHandModel Serialize + Deserialize", [&](uint32_t) {
+        const BasicHandModel copy = BasicHandModel::Deserialize(handModel.Serialize());
+        Sink = Sink + copy.GetFingerLengths().size();
+    });
+
+    const std::vector<std::vector<Vect3D>>& angles = pose.GetHandAngles();
+    Run(settings, "Serializer Vect3D[][] round trip", [&](uint32_t) {
+        Sink = Sink + Util::Serializer::DeserializeVects2D(Util::Serializer::Serialize(angles)).size();
+    });
+
+    const std::vector<std::vector<float>> lengths = handModel.GetFingerLengths();
+    Run(settings, "Serializer float[][] round trip", [&](uint32_t) {
+        Sink = Sink + Util::Serializer::DeserializeFloats2D(Util::Serializer::Serialize(lengths)).size();
+    });
+
+    const std::vector<std::vector<Quat>>& rotations = pose.GetJointRotations();
+    Run(settings, "Serializer Quat[][] round trip", [&](uint32_t) {
+        Sink = Sink + Util::Serializer::DeserializeQuats2D(Util::Serializer::Serialize(rotations)).size();
+    });
+}
+
+#if SG_CPP17
+/// <summary> The values of a Nova 2.0 raw sensor string, in caller-owned storage. </summary>
+struct Nova2Packet
+{
+    float SensorValues[5][3];
+    float ImuRotation[4];
+    int32_t BatteryLevel;
+    bool bCharging;
+};
+
+/// <summary> Parse a Nova 2.0 raw sensor string the way Nova2GloveSensorData::Parse splits it, with StringViewUtils
+/// instead of intermediate strings. Returns the amount of sensor values, which Parse reports as its parsed values.
+/// </summary>
+static int32_t ParseNova2Packet(std::string_view raw, Nova2Packet& out_packet)
+{
+    Util::StringViewUtils::Tokenizer sections(raw, Util::Communications::GetSectionDelimiter());
+    std::string_view section;
+    int32_t parsedValues = 0;
+    if (sections.Next(section)) {
+        Util::StringViewUtils::Tokenizer rows(section, Util::Communications::GetRowDelimiter());
+        std::string_view row;
+        for (uint32_t r = 0; r < 5 && rows.Next(row); ++r) {
+            Util::StringViewUtils::Tokenizer columns(row, Util::Communications::GetColumnDelimiter());
+            std::string_view column;
+            for (uint32_t c = 0; c < 3 && columns.Next(column); ++c) {
+                out_packet.SensorValues[r][c] = Util::StringViewUtils::ToFloat(column);
+                ++parsedValues;
+            }
+        }
+    }
+    if (sections.Next(section)) {
+        for (int32_t q = 0; q < 4; ++q) {
+            out_packet.ImuRotation[q] = Util::StringViewUtils::ToFloat(
+                Util::StringViewUtils::QuickSplit(section, Util::Communications::GetColumnDelimiter(), q));
+        }
+    }
+    if (sections.Next(section)) {
+        const char column = Util::Communications::GetColumnDelimiter();
+        out_packet.BatteryLevel = Util::StringViewUtils::ToInt(Util::StringViewUtils::QuickSplit(section, column, 0));
+        out_packet.bCharging = Util::StringViewUtils::ToInt(Util::StringViewUtils::QuickSplit(section, column, 1)) != 0;
+    }
+    return parsedValues;
+}
+#endif  /* SG_CPP17 */
+
+static void BenchStringView(const BenchSettings& settings)
+{
+#if SG_CPP17
+    const BasicHandModel handModel = BasicHandModel::Default(true);
+    const std::string serializedPose = HandPose::DefaultIdle(true, handModel).Serialize();
+    const std::string serializedLengths = Util::Serializer::Serialize(handModel.GetFingerLengths());
+
+    // Output vectors are re-used, so after the warm-up none of these should allocate.
+    std::vector<std::string_view> blocks;
+    RunZeroAllocation(settings, "StringViewUtils::SplitBlocks HandPose", [&](uint32_t) {
+        Sink = Sink + static_cast<std::size_t>(Util::StringViewUtils::SplitBlocks(serializedPose, blocks));
+    });
+
+    std::vector<std::string_view> fingers;
+    std::vector<float> values;
+    RunZeroAllocation(settings, "StringViewUtils::DeserializeFloats float[][]", [&](uint32_t) {
+        Util::StringViewUtils::SplitBlocks(Util::StringViewUtils::FilterBrackets(serializedLengths), fingers);
+        for (const std::string_view& finger : fingers) {
+            Sink = Sink + Util::StringViewUtils::DeserializeFloats(finger, values);
+        }
+    });
+
+    const std::string serializedFloats = "0.125;-12.5;3e2;+7;1000.75";
+    RunZeroAllocation(settings, "StringViewUtils::ToFloat", [&](uint32_t i) {
+        const std::string_view token = Util::StringViewUtils::QuickSplit(serializedFloats, ';',
+                                                                         static_cast<int32_t>(i % 5));
+        Sink = Sink + static_cast<std::size_t>(Util::StringViewUtils::ToFloat(token));
+    });
+
+    // The same packets as the Nova2GloveSensorData::Parse benchmark, into an output that is re-used.
+    const std::vector<std::string> nova2Samples = GenerateNovaSamples();
+    Nova2Packet packet{};
+    if (ParseNova2Packet(nova2Samples[0], packet) != 15) {
+        std::cout << "FAILED: ParseNova2Packet does not parse 15 sensor values." << std::endl;
+        ++FailedChecks;
+    }
+    RunZeroAllocation(settings, "StringViewUtils Nova 2.0 packet", [&](uint32_t i) {
+        Sink = Sink + static_cast<std::size_t>(ParseNova2Packet(nova2Samples[i % nova2Samples.size()], packet));
+    });
+#else   /* SG_CPP17 */
+    (void)settings;
+    std::cout << "StringViewUtils benchmarks skipped: requires C++17." << std::endl;
+#endif  /* SG_CPP17 */
+}
+
+/// <summary> Nova 2.0 streaming command built from strings, the way Nova2Glove::ToStreamCommand does. </summary>
+static std::string ToNova2StreamString(const std::vector<float>& forceFeedbackLevels, float squeezeLevel)
+{
+    std::string command;
+    command.push_back(Util::Communications::GetCommandOpen());
+    command.push_back('Z');
+    command.append(Util::Communications::ToSGBytes(forceFeedbackLevels, 4));
+    command.push_back(Util::Communications::FloatToSGByte(squeezeLevel));
+    command.push_back(Util::Communications::GetCommandClose());
+    return command;
+}
+
+static void BenchHaptics(const BenchSettings& settings)
+{
+    CustomWaveform waveform(0.8f, 0.2f, 180.0f);
+    Run(settings, "NovaGloveHapticEncoder::ToNova2Command", [&](uint32_t) {
+        Sink = Sink + Nova::NovaGloveHapticEncoder::ToNova2Command(waveform, 1).size();
+    });
+
+    // A 1 kHz stream encodes one command per glove per millisecond; levels change every frame.
+    std::vector<float> levels(4, 0.0f);
+    const auto updateLevels = [&](uint32_t i) {
+        for (std::size_t f = 0; f < levels.size(); ++f) {
+            levels[f] = static_cast<float>((i + f * 25) % 101) / 100.0f;
+        }
+    };
+
+    Util::HapticCommandBuffer buffer;
+    for (uint32_t i = 0; i < 101; ++i) {
+        updateLevels(i);
+        buffer.WriteNova2StreamCommand(levels, levels[0]);
+        if (!buffer.Equals(ToNova2StreamString(levels, levels[0]))) {
+            std::cout << "FAILED: HapticCommandBuffer does not match Communications::ToSGBytes." << std::endl;
+            ++FailedChecks;
+            break;
+        }
+    }
+
+    Run(settings, "Communications::ToSGBytes Nova 2.0 stream", [&](uint32_t i) {
+        updateLevels(i);
+        Sink = Sink + ToNova2StreamString(levels, levels[0]).size();
+    });
+
+    RunZeroAllocation(settings, "HapticCommandBuffer Nova 2.0 stream", [&](uint32_t i) {
+        updateLevels(i);
+        buffer.WriteNova2StreamCommand(levels, levels[0]);
+        Sink = Sink + buffer.GetSize();
+    });
+
+    std::string command;
+    RunZeroAllocation(settings, "HapticCommandBuffer Nova 2.0 stream + CopyTo", [&](uint32_t i) {
+        updateLevels(i);
+        buffer.WriteNova2StreamCommand(levels, levels[0]);
+        buffer.CopyTo(command);
+        Sink = Sink + command.size();
+    });
+}
+
+int main(int argc, char** argv)
+{
+    BenchSettings settings;
+    Recording recording;
+    for (int i = 1; i < argc; ++i) {
+        const std::string argument = argv[i];
+        if (argument == "--recording" && i + 1 < argc) {
+            if (!LoadRecording(argv[++i], recording)) {
+                std::cerr << "Could not open recording " << argv[i] << std::endl;
+                return 1;
+            }
+        } else if (argument == "--iterations" && i + 1 < argc) {
+            settings.Iterations = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+        } else if (argument == "--filter" && i + 1 < argc) {
+            settings.Filter = argv[++i];
+        } else {
+            std::cout << "Usage: sgcore-bench [--recording <file>] [--iterations <n>] [--filter <text>]" << std::endl;
+            return argument == "--help" ? 0 : 1;
+        }
+    }
+    if (settings.Iterations == 0) {
+        settings.Iterations = 1;
+    }
+
+    BenchParse(settings, recording);
+    BenchKinematics(settings);
+    BenchSerializer(settings);
+    BenchStringView(settings);
+    BenchHaptics(settings);
+    return FailedChecks > 0 ? 1 : 0;
+}
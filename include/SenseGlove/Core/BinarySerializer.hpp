@@ -0,0 +1,789 @@
+/**
+ * @file
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2026 SenseGlove
+ *
+ * @section DESCRIPTION
+ *
+ * Compact binary alternative to Serializer, for HandPoses, HandModels and
+ * sensor data. Every record starts with a small versioned header, so records
+ * can be stored back-to-back in session logs and streamed in and out of files.
+ * The bracketed text format remains available through Serialize().
+ */
+
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <istream>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "BasicHandModel.hpp"
+#include "HandPose.hpp"
+#include "NormalizationState.hpp"
+#include "Nova2GloveSensorData.hpp"
+#include "NovaGloveSensorData.hpp"
+#include "Platform.hpp"
+#include "Quat.hpp"
+#include "SenseGloveSensorData.hpp"
+#include "Vect3D.hpp"
+
+namespace SGCore
+{
+    namespace Util
+    {
+        /// <summary> Identifies the class stored in a binary record. Values are part of the format; never re-use them.
+        /// </summary>
+        enum class EBinaryRecordType : uint16_t
+        {
+            Unknown = 0,
+            HandPose = 1,
+            BasicHandModel = 2,
+            NovaGloveSensorData = 3,
+            Nova2GloveSensorData = 4,
+            SenseGloveSensorData = 5,
+        };
+
+        /// <summary> Utility class to serialize / deserialize classes into a compact binary format. </summary>
+        class BinarySerializer;
+
+        /// <summary> Writes binary records to an output stream, e.g. a session log. </summary>
+        class BinaryStreamWriter;
+
+        /// <summary> Reads binary records from an input stream, one at a time. </summary>
+        class BinaryStreamReader;
+    }// namespace Util
+}// namespace SGCore
+
+/// <summary> Utility class to serialize / deserialize classes into a compact binary format. </summary>
+/// <remarks> A record is a 12-byte header followed by its payload. The header holds the magic "SGBN", the format
+/// version, the EBinaryRecordType and the payload size in bytes. All values are little-endian, regardless of the
+/// host; floats are IEEE-754. Serialize functions append a record to out_buffer, so many records can be collected in
+/// one buffer. </remarks>
+class SGCore::Util::BinarySerializer
+{
+public:
+    /// <summary> First four bytes of every record ("SGBN"). </summary>
+    static constexpr uint32_t GetMagic()
+    {
+        return 0x4E424753u;
+    }
+
+    /// <summary> Version of the binary format written by this header. Readers accept this version or lower.
+    /// </summary>
+    static constexpr uint16_t GetFormatVersion()
+    {
+        return 1;
+    }
+
+    /// <summary> Size of a record header, in bytes. </summary>
+    static constexpr uint32_t GetHeaderSize()
+    {
+        return 12;
+    }
+
+public:
+    /// <summary> Appends little-endian values to a byte buffer. </summary>
+    class Writer
+    {
+    private:
+        std::string& Buffer;
+
+    public:
+        explicit Writer(std::string& out_buffer)
+            : Buffer(out_buffer)
+        {
+        }
+
+        void WriteUInt8(uint8_t value)
+        {
+            Buffer.push_back(static_cast<char>(value));
+        }
+
+        void WriteUInt16(uint16_t value)
+        {
+            const char bytes[2] = {static_cast<char>(value & 0xFFu), static_cast<char>((value >> 8) & 0xFFu)};
+            Buffer.append(bytes, 2);
+        }
+
+        void WriteUInt32(uint32_t value)
+        {
+            const char bytes[4] = {static_cast<char>(value & 0xFFu), static_cast<char>((value >> 8) & 0xFFu),
+                                   static_cast<char>((value >> 16) & 0xFFu), static_cast<char>((value >> 24) & 0xFFu)};
+            Buffer.append(bytes, 4);
+        }
+
+        void WriteInt32(int32_t value)
+        {
+            WriteUInt32(static_cast<uint32_t>(value));
+        }
+
+        void WriteFloat(float value)
+        {
+            uint32_t bits;
+            std::memcpy(&bits, &value, sizeof(uint32_t));
+            WriteUInt32(bits);
+        }
+
+        void WriteBool(bool bValue)
+        {
+            WriteUInt8(bValue ? 1 : 0);
+        }
+
+        void WriteVect3D(const Kinematics::Vect3D& vect)
+        {
+            WriteFloat(vect.GetX());
+            WriteFloat(vect.GetY());
+            WriteFloat(vect.GetZ());
+        }
+
+        void WriteQuat(const Kinematics::Quat& quat)
+        {
+            WriteFloat(quat.GetX());
+            WriteFloat(quat.GetY());
+            WriteFloat(quat.GetZ());
+            WriteFloat(quat.GetW());
+        }
+
+        void WriteFloats(const std::vector<float>& values)
+        {
+            WriteUInt32(static_cast<uint32_t>(values.size()));
+            for (float value : values) {
+                WriteFloat(value);
+            }
+        }
+
+        void WriteFloats2D(const std::vector<std::vector<float>>& values)
+        {
+            WriteUInt32(static_cast<uint32_t>(values.size()));
+            for (const std::vector<float>& inner : values) {
+                WriteFloats(inner);
+            }
+        }
+
+        void WriteVects(const std::vector<Kinematics::Vect3D>& values)
+        {
+            WriteUInt32(static_cast<uint32_t>(values.size()));
+            for (const Kinematics::Vect3D& value : values) {
+                WriteVect3D(value);
+            }
+        }
+
+        void WriteVects2D(const std::vector<std::vector<Kinematics::Vect3D>>& values)
+        {
+            WriteUInt32(static_cast<uint32_t>(values.size()));
+            for (const std::vector<Kinematics::Vect3D>& inner : values) {
+                WriteVects(inner);
+            }
+        }
+
+        void WriteQuats(const std::vector<Kinematics::Quat>& values)
+        {
+            WriteUInt32(static_cast<uint32_t>(values.size()));
+            for (const Kinematics::Quat& value : values) {
+                WriteQuat(value);
+            }
+        }
+
+        void WriteQuats2D(const std::vector<std::vector<Kinematics::Quat>>& values)
+        {
+            WriteUInt32(static_cast<uint32_t>(values.size()));
+            for (const std::vector<Kinematics::Quat>& inner : values) {
+                WriteQuats(inner);
+            }
+        }
+    };
+
+    /// <summary> Reads little-endian values from a byte buffer. Every read fails (returns false) instead of reading
+    /// past the end, and element counts are checked against the remaining bytes before anything is allocated.
+    /// </summary>
+    class Reader
+    {
+    private:
+        const unsigned char* Data;
+        std::size_t Size;
+        std::size_t Position = 0;
+
+    public:
+        Reader(const char* data, std::size_t size)
+            : Data(reinterpret_cast<const unsigned char*>(data)), Size(size)
+        {
+        }
+
+        SG_NODISCARD std::size_t GetRemaining() const
+        {
+            return Size - Position;
+        }
+
+        bool ReadUInt8(uint8_t& out_value)
+        {
+            if (GetRemaining() < 1) {
+                return false;
+            }
+            out_value = Data[Position++];
+            return true;
+        }
+
+        bool ReadUInt16(uint16_t& out_value)
+        {
+            if (GetRemaining() < 2) {
+                return false;
+            }
+            out_value = static_cast<uint16_t>(Data[Position] | (Data[Position + 1] << 8));
+            Position += 2;
+            return true;
+        }
+
+        bool ReadUInt32(uint32_t& out_value)
+        {
+            if (GetRemaining() < 4) {
+                return false;
+            }
+            out_value = static_cast<uint32_t>(Data[Position]) | (static_cast<uint32_t>(Data[Position + 1]) << 8)
+                        | (static_cast<uint32_t>(Data[Position + 2]) << 16)
+                        | (static_cast<uint32_t>(Data[Position + 3]) << 24);
+            Position += 4;
+            return true;
+        }
+
+        bool ReadInt32(int32_t& out_value)
+        {
+            uint32_t bits;
+            if (!ReadUInt32(bits)) {
+                return false;
+            }
+            out_value = static_cast<int32_t>(bits);
+            return true;
+        }
+
+        bool ReadFloat(float& out_value)
+        {
+            uint32_t bits;
+            if (!ReadUInt32(bits)) {
+                return false;
+            }
+            std::memcpy(&out_value, &bits, sizeof(float));
+            return true;
+        }
+
+        bool ReadBool(bool& out_bValue)
+        {
+            uint8_t value;
+            if (!ReadUInt8(value)) {
+                return false;
+            }
+            out_bValue = value != 0;
+            return true;
+        }
+
+        bool ReadVect3D(Kinematics::Vect3D& out_vect)
+        {
+            float x, y, z;
+            if (!ReadFloat(x) || !ReadFloat(y) || !ReadFloat(z)) {
+                return false;
+            }
+            out_vect = Kinematics::Vect3D(x, y, z);
+            return true;
+        }
+
+        bool ReadQuat(Kinematics::Quat& out_quat)
+        {
+            float x, y, z, w;
+            if (!ReadFloat(x) || !ReadFloat(y) || !ReadFloat(z) || !ReadFloat(w)) {
+                return false;
+            }
+            out_quat = Kinematics::Quat(x, y, z, w);
+            return true;
+        }
+
+        bool ReadFloats(std::vector<float>& out_values)
+        {
+            uint32_t count;
+            if (!ReadCount(count, 4)) {
+                return false;
+            }
+            out_values.resize(count);
+            for (float& value : out_values) {
+                ReadFloat(value);// size was checked by ReadCount.
+            }
+            return true;
+        }
+
+        bool ReadFloats2D(std::vector<std::vector<float>>& out_values)
+        {
+            uint32_t count;
+            if (!ReadCount(count, 4)) {
+                return false;
+            }
+            out_values.resize(count);
+            for (std::vector<float>& inner : out_values) {
+                if (!ReadFloats(inner)) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        bool ReadVects(std::vector<Kinematics::Vect3D>& out_values)
+        {
+            uint32_t count;
+            if (!ReadCount(count, 12)) {
+                return false;
+            }
+            out_values.clear();
+            out_values.reserve(count);
+            for (uint32_t i = 0; i < count; ++i) {
+                float x, y, z;
+                ReadFloat(x);
+                ReadFloat(y);
+                ReadFloat(z);
+                out_values.emplace_back(x, y, z);
+            }
+            return true;
+        }
+
+        bool ReadVects2D(std::vector<std::vector<Kinematics::Vect3D>>& out_values)
+        {
+            uint32_t count;
+            if (!ReadCount(count, 4)) {
+                return false;
+            }
+            out_values.resize(count);
+            for (std::vector<Kinematics::Vect3D>& inner : out_values) {
+                if (!ReadVects(inner)) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        bool ReadQuats(std::vector<Kinematics::Quat>& out_values)
+        {
+            uint32_t count;
+            if (!ReadCount(count, 16)) {
+                return false;
+            }
+            out_values.clear();
+            out_values.reserve(count);
+            for (uint32_t i = 0; i < count; ++i) {
+                float x, y, z, w;
+                ReadFloat(x);
+                ReadFloat(y);
+                ReadFloat(z);
+                ReadFloat(w);
+                out_values.emplace_back(x, y, z, w);
+            }
+            return true;
+        }
+
+        bool ReadQuats2D(std::vector<std::vector<Kinematics::Quat>>& out_values)
+        {
+            uint32_t count;
+            if (!ReadCount(count, 4)) {
+                return false;
+            }
+            out_values.resize(count);
+            for (std::vector<Kinematics::Quat>& inner : out_values) {
+                if (!ReadQuats(inner)) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+    private:
+        /// <summary> Read an element count, and check that count elements of at least elementSize bytes fit in
+        /// the remaining data. </summary>
+        bool ReadCount(uint32_t& out_count, std::size_t elementSize)
+        {
+            return ReadUInt32(out_count) && static_cast<uint64_t>(out_count) * elementSize <= GetRemaining();
+        }
+    };
+
+public:
+    //--------------------------------------------------------------------------------------
+    // Headers
+
+    /// <summary> Parse the header at the start of data. Returns false if there is no complete, valid header, or if
+    /// it was written by a newer format version. </summary>
+    static bool ReadHeader(const char* data, std::size_t size, EBinaryRecordType& out_type, uint32_t& out_payloadSize)
+    {
+        Reader reader(data, size);
+        uint32_t magic;
+        uint16_t version;
+        uint16_t type;
+        if (!reader.ReadUInt32(magic) || !reader.ReadUInt16(version) || !reader.ReadUInt16(type)
+            || !reader.ReadUInt32(out_payloadSize)) {
+            return false;
+        }
+        out_type = static_cast<EBinaryRecordType>(type);
+        return magic == GetMagic() && version != 0 && version <= GetFormatVersion();
+    }
+
+    //--------------------------------------------------------------------------------------
+    // Serialization
+
+    /// <summary> Append a HandPose record to out_buffer. </summary>
+    static void Serialize(const HandPose& handPose, std::string& out_buffer)
+    {
+        const std::size_t start = BeginRecord(EBinaryRecordType::HandPose, out_buffer);
+        Writer writer(out_buffer);
+        writer.WriteBool(handPose.IsRight());
+        writer.WriteVects2D(handPose.GetJointPositions());
+        writer.WriteQuats2D(handPose.GetJointRotations());
+        writer.WriteVects2D(handPose.GetHandAngles());
+        EndRecord(start, out_buffer);
+    }
+
+    /// <summary> Append a BasicHandModel record to out_buffer. </summary>
+    static void Serialize(const Kinematics::BasicHandModel& handModel, std::string& out_buffer)
+    {
+        const std::size_t start = BeginRecord(EBinaryRecordType::BasicHandModel, out_buffer);
+        Writer writer(out_buffer);
+        writer.WriteBool(handModel.IsRight());
+        writer.WriteFloats2D(handModel.GetFingerLengths());
+        writer.WriteVects(handModel.GetStartJointPositions());
+        writer.WriteQuats(handModel.GetStartJointRotations());
+        EndRecord(start, out_buffer);
+    }
+
+    /// <summary> Append a NovaGloveSensorData record to out_buffer. </summary>
+    /// <remarks> The normalization state is not stored; NovaGloveSensorData can not be constructed with one.
+    /// </remarks>
+    static void Serialize(const Nova::NovaGloveSensorData& sensorData, std::string& out_buffer)
+    {
+        const std::size_t start = BeginRecord(EBinaryRecordType::NovaGloveSensorData, out_buffer);
+        Writer writer(out_buffer);
+        writer.WriteVects(sensorData.GetSensorValues());
+        writer.WriteInt32(sensorData.GetParsedValues());
+        writer.WriteQuat(sensorData.GetImuRotation());
+        writer.WriteBool(sensorData.IsImuParsed());
+        writer.WriteFloat(sensorData.GetBatteryLevel());
+        writer.WriteBool(sensorData.IsCharging());
+        EndRecord(start, out_buffer);
+    }
+
+    /// <summary> Append a Nova2GloveSensorData record to out_buffer. </summary>
+    static void Serialize(const Nova::Nova2GloveSensorData& sensorData, std::string& out_buffer)
+    {
+        const std::size_t start = BeginRecord(EBinaryRecordType::Nova2GloveSensorData, out_buffer);
+        Writer writer(out_buffer);
+        writer.WriteUInt8(static_cast<uint8_t>(sensorData.GetSensorState()));
+        writer.WriteVects2D(sensorData.GetSensorValues());
+        writer.WriteInt32(sensorData.GetParsedValues());
+        writer.WriteQuat(sensorData.GetImuRotation());
+        writer.WriteBool(sensorData.IsImuParsed());
+        writer.WriteFloat(sensorData.GetBatteryLevel());
+        writer.WriteBool(sensorData.IsCharging());
+        EndRecord(start, out_buffer);
+    }
+
+    /// <summary> Append a SenseGloveSensorData record to out_buffer. </summary>
+    static void Serialize(const SG::SenseGloveSensorData& sensorData, std::string& out_buffer)
+    {
+        const std::size_t start = BeginRecord(EBinaryRecordType::SenseGloveSensorData, out_buffer);
+        Writer writer(out_buffer);
+        writer.WriteFloats2D(sensorData.GetSensorAngles());
+        writer.WriteQuat(sensorData.GetImuRotation());
+        writer.WriteInt32(sensorData.GetParsedValues());
+        writer.WriteBool(sensorData.IsImuParsed());
+        EndRecord(start, out_buffer);
+    }
+
+    //--------------------------------------------------------------------------------------
+    // Deserialization
+
+    /// <summary> Deserialize the HandPose record at the start of data. Returns false if data does not start with
+    /// a complete HandPose record. out_consumed, if given, receives the size of the record. </summary>
+    static bool Deserialize(const char* data, std::size_t size, HandPose& out_handPose,
+                            std::size_t* out_consumed = nullptr)
+    {
+        Reader reader = BeginRead(data, size, EBinaryRecordType::HandPose, out_consumed);
+        bool bRightHanded = false;
+        std::vector<std::vector<Kinematics::Vect3D>> positions;
+        std::vector<std::vector<Kinematics::Quat>> rotations;
+        std::vector<std::vector<Kinematics::Vect3D>> angles;
+        if (!reader.ReadBool(bRightHanded) || !reader.ReadVects2D(positions) || !reader.ReadQuats2D(rotations)
+            || !reader.ReadVects2D(angles)) {
+            return false;
+        }
+        out_handPose = HandPose(bRightHanded, positions, rotations, angles);
+        return true;
+    }
+
+    /// <summary> Deserialize the BasicHandModel record at the start of data. </summary>
+    static bool Deserialize(const char* data, std::size_t size, Kinematics::BasicHandModel& out_handModel,
+                            std::size_t* out_consumed = nullptr)
+    {
+        Reader reader = BeginRead(data, size, EBinaryRecordType::BasicHandModel, out_consumed);
+        bool bRightHanded = false;
+        std::vector<std::vector<float>> lengths;
+        std::vector<Kinematics::Vect3D> positions;
+        std::vector<Kinematics::Quat> rotations;
+        if (!reader.ReadBool(bRightHanded) || !reader.ReadFloats2D(lengths) || !reader.ReadVects(positions)
+            || !reader.ReadQuats(rotations)) {
+            return false;
+        }
+        out_handModel = Kinematics::BasicHandModel(bRightHanded, lengths, positions, rotations);
+        return true;
+    }
+
+    /// <summary> Deserialize the NovaGloveSensorData record at the start of data. </summary>
+    static bool Deserialize(const char* data, std::size_t size, Nova::NovaGloveSensorData& out_sensorData,
+                            std::size_t* out_consumed = nullptr)
+    {
+        Reader reader = BeginRead(data, size, EBinaryRecordType::NovaGloveSensorData, out_consumed);
+        std::vector<Kinematics::Vect3D> values;
+        int32_t parsedValues = 0;
+        Kinematics::Quat imu;
+        bool bImuParsed = false;
+        float batteryLevel = 0.0f;
+        bool bCharging = false;
+        if (!reader.ReadVects(values) || !reader.ReadInt32(parsedValues) || !reader.ReadQuat(imu)
+            || !reader.ReadBool(bImuParsed) || !reader.ReadFloat(batteryLevel) || !reader.ReadBool(bCharging)) {
+            return false;
+        }
+        out_sensorData = Nova::NovaGloveSensorData(values, parsedValues, imu, bImuParsed, batteryLevel, bCharging);
+        return true;
+    }
+
+    /// <summary> Deserialize the Nova2GloveSensorData record at the start of data. </summary>
+    static bool Deserialize(const char* data, std::size_t size, Nova::Nova2GloveSensorData& out_sensorData,
+                            std::size_t* out_consumed = nullptr)
+    {
+        Reader reader = BeginRead(data, size, EBinaryRecordType::Nova2GloveSensorData, out_consumed);
+        uint8_t state = 0;
+        std::vector<std::vector<Kinematics::Vect3D>> values;
+        int32_t parsedValues = 0;
+        Kinematics::Quat imu;
+        bool bImuParsed = false;
+        float batteryLevel = 0.0f;
+        bool bCharging = false;
+        if (!reader.ReadUInt8(state) || !reader.ReadVects2D(values) || !reader.ReadInt32(parsedValues)
+            || !reader.ReadQuat(imu) || !reader.ReadBool(bImuParsed) || !reader.ReadFloat(batteryLevel)
+            || !reader.ReadBool(bCharging)) {
+            return false;
+        }
+        out_sensorData = Nova::Nova2GloveSensorData(static_cast<Nova::ENormalizationState>(state), values,
+                                                    parsedValues, imu, bImuParsed, batteryLevel, bCharging);
+        return true;
+    }
+
+    /// <summary> Deserialize the SenseGloveSensorData record at the start of data. </summary>
+    static bool Deserialize(const char* data, std::size_t size, SG::SenseGloveSensorData& out_sensorData,
+                            std::size_t* out_consumed = nullptr)
+    {
+        Reader reader = BeginRead(data, size, EBinaryRecordType::SenseGloveSensorData, out_consumed);
+        std::vector<std::vector<float>> angles;
+        Kinematics::Quat imu;
+        int32_t parsedValues = 0;
+        bool bImuParsed = false;
+        if (!reader.ReadFloats2D(angles) || !reader.ReadQuat(imu) || !reader.ReadInt32(parsedValues)
+            || !reader.ReadBool(bImuParsed)) {
+            return false;
+        }
+        out_sensorData = SG::SenseGloveSensorData(angles, imu, parsedValues, bImuParsed);
+        return true;
+    }
+
+    /// <summary> Deserialize the first record in a buffer. </summary>
+    template<typename T>
+    static bool Deserialize(const std::string& buffer, T& out_value)
+    {
+        return Deserialize(buffer.data(), buffer.size(), out_value);
+    }
+
+private:
+    static std::size_t BeginRecord(EBinaryRecordType type, std::string& out_buffer)
+    {
+        const std::size_t start = out_buffer.size();
+        Writer writer(out_buffer);
+        writer.WriteUInt32(GetMagic());
+        writer.WriteUInt16(GetFormatVersion());
+        writer.WriteUInt16(static_cast<uint16_t>(type));
+        writer.WriteUInt32(0);// payload size, filled in by EndRecord.
+        return start;
+    }
+
+    static void EndRecord(std::size_t start, std::string& out_buffer)
+    {
+        const uint32_t payloadSize = static_cast<uint32_t>(out_buffer.size() - start - GetHeaderSize());
+        for (uint32_t i = 0; i < 4; ++i) {
+            out_buffer[start + 8 + i] = static_cast<char>((payloadSize >> (8 * i)) & 0xFFu);
+        }
+    }
+
+    /// <summary> Validate the header of a record of the expected type, and return a Reader over its payload. On
+    /// failure, the returned Reader is empty so that every read fails. </summary>
+    static Reader BeginRead(const char* data, std::size_t size, EBinaryRecordType expectedType,
+                            std::size_t* out_consumed)
+    {
+        EBinaryRecordType type;
+        uint32_t payloadSize;
+        if (!ReadHeader(data, size, type, payloadSize) || type != expectedType
+            || size - GetHeaderSize() < payloadSize) {
+            return Reader(data, 0);
+        }
+        if (out_consumed != nullptr) {
+            *out_consumed = GetHeaderSize() + static_cast<std::size_t>(payloadSize);
+        }
+        return Reader(data + GetHeaderSize(), payloadSize);
+    }
+
+public:
+    BinarySerializer() = delete;
+    ~BinarySerializer() = delete;
+};
+
+/// <summary> Writes binary records to an output stream, e.g. a session log. </summary>
+/// <remarks> Re-uses one internal buffer, so after the first few records writing does not allocate beyond what
+/// the stream itself does. </remarks>
+class SGCore::Util::BinaryStreamWriter
+{
+private:
+    std::ostream& Stream;
+    std::string Buffer;
+    uint64_t RecordsWritten = 0;
+
+public:
+    explicit BinaryStreamWriter(std::ostream& stream)
+        : Stream(stream)
+    {
+    }
+
+    BinaryStreamWriter(const BinaryStreamWriter& rhs) = delete;
+
+    BinaryStreamWriter& operator=(const BinaryStreamWriter& rhs) = delete;
+
+public:
+    /// <summary> Write a single record. Accepts any type BinarySerializer::Serialize does. Returns false if the
+    /// stream failed. </summary>
+    template<typename T>
+    bool Write(const T& value)
+    {
+        Buffer.clear();
+        BinarySerializer::Serialize(value, Buffer);
+        Stream.write(Buffer.data(), static_cast<std::streamsize>(Buffer.size()));
+        if (!Stream.good()) {
+            return false;
+        }
+        ++RecordsWritten;
+        return true;
+    }
+
+    /// <summary> Amount of records written successfully. </summary>
+    SG_NODISCARD uint64_t GetRecordsWritten() const
+    {
+        return RecordsWritten;
+    }
+};
+
+/// <summary> Reads binary records from an input stream, one at a time. </summary>
+/// <remarks> Call Next() to load the next record and learn its type, then Read() it into an object of that type, or
+/// simply call Next() again to skip it. Records with an unknown type are skipped the same way, so logs written by a
+/// newer version remain readable as long as the format version did not change. </remarks>
+class SGCore::Util::BinaryStreamReader
+{
+public:
+    /// <summary> Largest payload accepted unless specified otherwise, in bytes. Far above any record this library
+    /// writes. </summary>
+    static constexpr uint32_t DefaultMaxRecordSize = 1024 * 1024;
+
+private:
+    std::istream& Stream;
+    std::string Record;
+    std::size_t MaxRecordSize;
+    EBinaryRecordType CurrentType = EBinaryRecordType::Unknown;
+    bool bCorrupt = false;
+
+public:
+    /// <summary> Read records from stream. A record whose header claims a payload larger than maxRecordSize bytes
+    /// is treated as corrupt, so a damaged or hostile stream cannot make the reader allocate arbitrary amounts of
+    /// memory. </summary>
+    explicit BinaryStreamReader(std::istream& stream, std::size_t maxRecordSize = DefaultMaxRecordSize)
+        : Stream(stream), MaxRecordSize(maxRecordSize)
+    {
+    }
+
+    BinaryStreamReader(const BinaryStreamReader& rhs) = delete;
+
+    BinaryStreamReader& operator=(const BinaryStreamReader& rhs) = delete;
+
+public:
+    /// <summary> Load the next record. Returns false at the end of the stream, or when the stream does not contain
+    /// a valid record; see IsCorrupt(). </summary>
+    bool Next(EBinaryRecordType& out_type)
+    {
+        CurrentType = EBinaryRecordType::Unknown;
+        out_type = CurrentType;
+        if (bCorrupt) {
+            return false;
+        }
+        const std::size_t headerSize = BinarySerializer::GetHeaderSize();
+        Record.resize(headerSize);
+        Stream.read(&Record[0], static_cast<std::streamsize>(headerSize));
+        if (Stream.gcount() == 0) {
+            return false;// clean end of stream.
+        }
+        EBinaryRecordType type;
+        uint32_t payloadSize;
+        if (static_cast<std::size_t>(Stream.gcount()) != headerSize
+            || !BinarySerializer::ReadHeader(Record.data(), Record.size(), type, payloadSize)
+            || payloadSize > MaxRecordSize || payloadSize > Record.max_size() - headerSize) {
+            bCorrupt = true;
+            return false;
+        }
+        Record.resize(headerSize + payloadSize);
+        Stream.read(&Record[headerSize], static_cast<std::streamsize>(payloadSize));
+        if (static_cast<uint32_t>(Stream.gcount()) != payloadSize) {
+            bCorrupt = true;
+            return false;
+        }
+        CurrentType = type;
+        out_type = type;
+        return true;
+    }
+
+    /// <summary> Deserialize the record loaded by Next(). Returns false if it is not of type T. </summary>
+    template<typename T>
+    bool Read(T& out_value) const
+    {
+        return CurrentType != EBinaryRecordType::Unknown
+               && BinarySerializer::Deserialize(Record.data(), Record.size(), out_value);
+    }
+
+    /// <summary> Returns true if reading stopped because of a truncated, invalid or oversized record, rather than at
+    /// the end of the stream. </summary>
+    SG_NODISCARD bool IsCorrupt() const
+    {
+        return bCorrupt;
+    }
+};
+
+namespace SGCore
+{
+    namespace Util
+    {
+        /// <summary> Serialize a HandPose, BasicHandModel or sensor data into a compact binary record. </summary>
+        template<typename T>
+        SG_NODISCARD inline std::string SerializeBinary(const T& value)
+        {
+            std::string buffer;
+            BinarySerializer::Serialize(value, buffer);
+            return buffer;
+        }
+
+        /// <summary> Convert a binary record created by SerializeBinary back into its class representation. Returns
+        /// false, and leaves out_value untouched, if the record is invalid or holds a different type. </summary>
+        template<typename T>
+        inline bool DeserializeBinary(const std::string& serialized, T& out_value)
+        {
+            return BinarySerializer::Deserialize(serialized, out_value);
+        }
+    }// namespace Util
+}// namespace SGCore
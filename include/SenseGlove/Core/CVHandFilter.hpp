@@ -0,0 +1,300 @@
+/**
+ * @file
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2026 SenseGlove
+ *
+ * @section DESCRIPTION
+ *
+ * Low-latency adaptive filters for CV hand data: a One-Euro filter and a
+ * constant-velocity Kalman filter, applied to the wrist pose and every hand
+ * angle of a FlatCVHandData. Used by FlatCVHandDataSmoother to remove jitter
+ * without running a frame behind.
+ */
+
+
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+#include "FlatCVHandData.hpp"
+#include "Platform.hpp"
+
+namespace SGCore
+{
+    namespace CV
+    {
+        /// <summary> The way CV frames are filtered before they are smoothed. </summary>
+        enum class ECVFilterMethod : uint8_t
+        {
+            /// <summary> Frames are used as they are received. </summary>
+            None = 0,
+
+            /// <summary> One-Euro filter: a low-pass filter whose cutoff rises with speed. Removes jitter while
+            /// holding still, and adds little lag during fast motion. </summary>
+            OneEuro,
+
+            /// <summary> Kalman filter with a constant-velocity model per value. Tracks velocity as well, so it lags
+            /// less than a low-pass filter of the same smoothness, but may overshoot on sudden stops. </summary>
+            Kalman,
+        };
+
+        /// <summary> Filters each value of consecutive FlatCVHandData with a One-Euro or Kalman filter. </summary>
+        class CVHandFilter;
+    }// namespace CV
+}// namespace SGCore
+
+/// <summary> Filters each value of consecutive FlatCVHandData with a One-Euro or Kalman filter. </summary>
+/// <remarks> Every value is filtered on its own: the wrist position, the four components of the wrist rotation
+/// (re-normalized afterwards) and every hand angle. The wrist position and the angles have separate settings, since
+/// they are in different units; the rotation uses the angle settings. The time between frames is taken from their
+/// timestamps, so irregular frame rates are handled. A filter keeps state for a single hand. </remarks>
+class SGCore::CV::CVHandFilter
+{
+public:
+    /// <summary> Filter parameters for one kind of value. </summary>
+    struct ChannelSettings
+    {
+        /// <summary> One-Euro: cutoff frequency while holding still, in Hz. Lower removes more jitter. </summary>
+        float MinCutoff;
+
+        /// <summary> One-Euro: how much the cutoff rises with speed. Higher lags less during fast motion. </summary>
+        float Beta;
+
+        /// <summary> One-Euro: cutoff frequency used to smooth the speed estimate, in Hz. </summary>
+        float DerivativeCutoff;
+
+        /// <summary> Kalman: variance of the acceleration, per second squared. Higher follows changes faster.
+        /// </summary>
+        float ProcessNoise;
+
+        /// <summary> Kalman: variance of the measurement noise. Higher removes more jitter. </summary>
+        float MeasurementNoise;
+
+        ChannelSettings(float minCutoff, float beta, float derivativeCutoff, float processNoise,
+                        float measurementNoise)
+            : MinCutoff(minCutoff), Beta(beta), DerivativeCutoff(derivativeCutoff), ProcessNoise(processNoise),
+              MeasurementNoise(measurementNoise)
+        {
+        }
+    };
+
+    /// <summary> Settings of the filter. </summary>
+    struct Settings
+    {
+        /// <summary> Which filter to apply. </summary>
+        ECVFilterMethod Method = ECVFilterMethod::None;
+
+        /// <summary> Parameters for the wrist position. The defaults assume mm. </summary>
+        ChannelSettings Position = ChannelSettings(1.5f, 0.05f, 1.0f, 1.0e6f, 4.0f);
+
+        /// <summary> Parameters for the wrist rotation and hand angles, in radians. </summary>
+        ChannelSettings Angles = ChannelSettings(1.5f, 2.0f, 1.0f, 400.0f, 4.0e-4f);
+    };
+
+    /// <summary> Amount of filtered values: wrist position, wrist rotation and hand angles. </summary>
+    static constexpr uint32_t ChannelCount = 3 + 4 + FlatCVHandData::MaxFingers * FlatCVHandData::MaxJoints * 3;
+
+private:
+    static constexpr uint32_t PositionChannels = 3;
+
+    Settings Config;
+    bool bInitialized = false;
+    float LastTimestamp = 0.0f;
+
+    // One-Euro state, or Kalman position estimate / velocity estimate.
+    float Value[ChannelCount];
+    float Derivative[ChannelCount];
+
+    // Kalman covariance; symmetric, so P10 == P01.
+    float P00[ChannelCount];
+    float P01[ChannelCount];
+    float P11[ChannelCount];
+
+public:
+    CVHandFilter()
+    {
+        Reset();
+    }
+
+    explicit CVHandFilter(const Settings& settings)
+        : Config(settings)
+    {
+        Reset();
+    }
+
+    ~CVHandFilter() = default;
+
+public:
+    //--------------------------------------------------------------------------------------
+    // Accessors
+
+    SG_NODISCARD const Settings& GetSettings() const
+    {
+        return Config;
+    }
+
+    /// <summary> Change the settings. Resets the filter if the method changes. </summary>
+    void SetSettings(const Settings& settings)
+    {
+        const bool bMethodChanged = settings.Method != Config.Method;
+        Config = settings;
+        if (bMethodChanged) {
+            Reset();
+        }
+    }
+
+    SG_NODISCARD ECVFilterMethod GetMethod() const
+    {
+        return Config.Method;
+    }
+
+    /// <summary> Change the filter method. Resets the filter if it changes. </summary>
+    void SetMethod(ECVFilterMethod method)
+    {
+        Settings settings = Config;
+        settings.Method = method;
+        SetSettings(settings);
+    }
+
+    //--------------------------------------------------------------------------------------
+    // Filtering
+
+    /// <summary> Forget all previous frames; the next one is passed through as-is. </summary>
+    void Reset()
+    {
+        bInitialized = false;
+        LastTimestamp = 0.0f;
+        std::memset(Value, 0, sizeof(Value));
+        std::memset(Derivative, 0, sizeof(Derivative));
+        std::memset(P00, 0, sizeof(P00));
+        std::memset(P01, 0, sizeof(P01));
+        std::memset(P11, 0, sizeof(P11));
+    }
+
+    /// <summary> Filter the values of a frame in place, using the frames filtered before it. Frames that are not
+    /// newer than the previous one are replaced by the current estimate. Does not allocate. </summary>
+    void Apply(FlatCVHandData& inout_frame)
+    {
+        if (Config.Method == ECVFilterMethod::None || !inout_frame.bValid) {
+            return;
+        }
+        float values[ChannelCount];
+        Gather(inout_frame, values);
+
+        if (!bInitialized) {
+            Initialize(values);
+            LastTimestamp = inout_frame.Timestamp;
+            return;
+        }
+        const float dt = inout_frame.Timestamp - LastTimestamp;
+        if (dt > 0.0f) {
+            // q and -q are the same rotation; keep the measurement on the side of the estimate.
+            const float dot = values[3] * Value[3] + values[4] * Value[4] + values[5] * Value[5]
+                              + values[6] * Value[6];
+            if (dot < 0.0f) {
+                for (uint32_t i = 3; i < 7; ++i) {
+                    values[i] = -values[i];
+                }
+            }
+            const uint32_t positionChannels = PositionChannels;
+            const uint32_t channelCount = ChannelCount;
+            if (Config.Method == ECVFilterMethod::OneEuro) {
+                FilterOneEuro(values, 0, positionChannels, dt, Config.Position);
+                FilterOneEuro(values, positionChannels, channelCount, dt, Config.Angles);
+            } else {
+                FilterKalman(values, 0, positionChannels, dt, Config.Position);
+                FilterKalman(values, positionChannels, channelCount, dt, Config.Angles);
+            }
+            LastTimestamp = inout_frame.Timestamp;
+        }
+        Scatter(inout_frame);
+    }
+
+private:
+    void Initialize(const float (&values)[ChannelCount])
+    {
+        for (uint32_t i = 0; i < ChannelCount; ++i) {
+            const ChannelSettings& channel = i < PositionChannels ? Config.Position : Config.Angles;
+            Value[i] = values[i];
+            Derivative[i] = 0.0f;
+            P00[i] = channel.MeasurementNoise;
+            P01[i] = 0.0f;
+            P11[i] = channel.ProcessNoise;// velocity is unknown; allow it to converge quickly.
+        }
+        bInitialized = true;
+    }
+
+    static void Gather(const FlatCVHandData& frame, float (&out_values)[ChannelCount])
+    {
+        std::memcpy(out_values, frame.WristPosition, sizeof(frame.WristPosition));
+        std::memcpy(out_values + 3, frame.WristRotation, sizeof(frame.WristRotation));
+        std::memcpy(out_values + 7, frame.HandAngles, sizeof(frame.HandAngles));
+    }
+
+    void Scatter(FlatCVHandData& out_frame) const
+    {
+        std::memcpy(out_frame.WristPosition, Value, sizeof(out_frame.WristPosition));
+        std::memcpy(out_frame.HandAngles, Value + 7, sizeof(out_frame.HandAngles));
+        float lengthSquared = 0.0f;
+        for (uint32_t i = 0; i < 4; ++i) {
+            lengthSquared += Value[3 + i] * Value[3 + i];
+        }
+        if (lengthSquared > 0.0f) {
+            const float scale = 1.0f / std::sqrt(lengthSquared);
+            for (uint32_t i = 0; i < 4; ++i) {
+                out_frame.WristRotation[i] = Value[3 + i] * scale;
+            }
+        }
+    }
+
+    /// <summary> Smoothing factor of an exponential low-pass filter with the given cutoff frequency. </summary>
+    static float GetAlpha(float cutoff, float dt)
+    {
+        const float twoPi = 6.28318530718f;
+        const float tau = 1.0f / (twoPi * cutoff);
+        return 1.0f / (1.0f + tau / dt);
+    }
+
+    void FilterOneEuro(const float (&values)[ChannelCount], uint32_t begin, uint32_t end, float dt,
+                       const ChannelSettings& channel)
+    {
+        const float derivativeAlpha = GetAlpha(channel.DerivativeCutoff, dt);
+        for (uint32_t i = begin; i < end; ++i) {
+            const float rawDerivative = (values[i] - Value[i]) / dt;
+            Derivative[i] += derivativeAlpha * (rawDerivative - Derivative[i]);
+            const float cutoff = channel.MinCutoff + channel.Beta * std::fabs(Derivative[i]);
+            Value[i] += GetAlpha(cutoff, dt) * (values[i] - Value[i]);
+        }
+    }
+
+    void FilterKalman(const float (&values)[ChannelCount], uint32_t begin, uint32_t end, float dt,
+                      const ChannelSettings& channel)
+    {
+        // White-noise acceleration model.
+        const float dt2 = dt * dt;
+        const float q00 = channel.ProcessNoise * dt2 * dt2 * 0.25f;
+        const float q01 = channel.ProcessNoise * dt2 * dt * 0.5f;
+        const float q11 = channel.ProcessNoise * dt2;
+        for (uint32_t i = begin; i < end; ++i) {
+            // Predict.
+            Value[i] += Derivative[i] * dt;
+            P00[i] += dt * (2.0f * P01[i] + dt * P11[i]) + q00;
+            P01[i] += dt * P11[i] + q01;
+            P11[i] += q11;
+
+            // Update.
+            const float gain0 = P00[i] / (P00[i] + channel.MeasurementNoise);
+            const float gain1 = P01[i] / (P00[i] + channel.MeasurementNoise);
+            const float innovation = values[i] - Value[i];
+            Value[i] += gain0 * innovation;
+            Derivative[i] += gain1 * innovation;
+            P11[i] -= gain1 * P01[i];
+            P01[i] -= gain0 * P01[i];
+            P00[i] -= gain0 * P00[i];
+        }
+    }
+};
@@ -0,0 +1,376 @@
+/**
+ * @file
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2026 SenseGlove
+ *
+ * @section DESCRIPTION
+ *
+ * Asynchronous counterpart of CVHandLayer. PostHandData only queues a frame;
+ * a pool of worker threads converts queued frames into hand angles and feeds
+ * them to one CVHandDataSmoother per hand. Intended for CV trackers that post
+ * several hands at a high rate from their own vision thread.
+ */
+
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "CVHandDataSmoother.hpp"
+#include "CVHandLayer.hpp"
+#include "CVHandTrackingData.hpp"
+#include "CVProcessedHandData.hpp"
+#include "DeviceTypes.hpp"
+#include "Platform.hpp"
+
+namespace SGCore
+{
+    namespace CV
+    {
+        /// <summary> Queues CV frames and processes them on a pool of worker threads, one smoother per hand. </summary>
+        class CVHandIngestion;
+    }// namespace CV
+}// namespace SGCore
+
+/// <summary> Queues CV frames and processes them on a pool of worker threads, one smoother per hand. </summary>
+/// <remarks> Offers the same PostHandData / TryGetPose / PoseAvailable / ClearCVData calls as CVHandLayer, but
+/// PostHandData only copies the frame into the queue of its hand and returns. Each hand is processed by at most one
+/// worker at a time, so its frames reach the smoother in the order they were posted, while different hands are
+/// processed in parallel. When a hand's queue is full, its oldest frame is dropped: the smoother only cares about the
+/// latest frames. TryGetPose never waits for a worker; if one is updating the hand's smoother, the pose smoothed by
+/// the previous call is returned instead. Hands are stored in a fixed-size table, so looking one up takes no lock.
+/// </remarks>
+class SGCore::CV::CVHandIngestion
+{
+public:
+    /// <summary> Maximum amount of distinct hand / device type / hardware version combinations. </summary>
+    static constexpr uint32_t MaxHands = 16;
+
+    /// <summary> Settings of the worker pool. </summary>
+    struct Settings
+    {
+        /// <summary> Amount of worker threads. More than the amount of hands does not help. </summary>
+        uint32_t WorkerCount = 2;
+
+        /// <summary> Frames queued per hand before the oldest one is dropped. </summary>
+        uint32_t QueueCapacity = 4;
+
+        /// <summary> Smoothing method of newly created smoothers. </summary>
+        ESmoothingMethod SmoothingMethod = ESmoothingMethod::InterpolateBehind;
+    };
+
+private:
+    /// <summary> Queue, smoother and latest result of a single hand. </summary>
+    struct Hand
+    {
+        // Set once, before the hand is published in Hands.
+        bool bRightHanded = false;
+        EDeviceType DeviceType = EDeviceType::Unknown;
+        std::string HardwareVersion;
+
+        // Guarded by QueueMutex.
+        std::deque<CVHandTrackingData> Pending;
+        bool bScheduled = false;
+
+        // Guarded by SmootherMutex; only held by a worker while it adds frames, or by a reader while it smooths.
+        std::mutex SmootherMutex;
+        std::unique_ptr<CVHandDataSmoother> Smoother;
+
+        // Guarded by PoseMutex, which is only held to copy a pose.
+        std::mutex PoseMutex;
+        CVProcessedHandData LastPose;
+        bool bHasPose = false;
+
+        std::atomic<bool> bAvailable{false};
+
+        bool Matches(bool bRight, EDeviceType type, const std::string& hardwareVersion) const
+        {
+            return bRightHanded == bRight && DeviceType == type && HardwareVersion == hardwareVersion;
+        }
+    };
+
+private:
+    Settings Config;
+
+    std::unique_ptr<Hand> Hands[MaxHands];
+    std::atomic<uint32_t> HandCount{0};
+    std::mutex HandsMutex;// only taken to add a hand.
+
+    std::mutex QueueMutex;
+    std::condition_variable Wake;
+    std::deque<Hand*> Ready;// hands with pending frames, not yet picked up by a worker.
+
+    std::vector<std::thread> Workers;
+    std::atomic<bool> bRunning{false};
+    std::atomic<uint64_t> ProcessedFrames{0};
+    std::atomic<uint64_t> DroppedFrames{0};
+
+public:
+    CVHandIngestion() = default;
+
+    explicit CVHandIngestion(const Settings& settings)
+        : Config(settings)
+    {
+    }
+
+    CVHandIngestion(const CVHandIngestion& rhs) = delete;
+
+    ~CVHandIngestion()
+    {
+        Stop();
+    }
+
+public:
+    CVHandIngestion& operator=(const CVHandIngestion& rhs) = delete;
+
+public:
+    //--------------------------------------------------------------------------------------
+    // Worker pool
+
+    /// <summary> Start the worker threads. Frames posted while stopped are processed right away. Returns false if
+    /// already running. </summary>
+    bool Start()
+    {
+        if (bRunning.exchange(true, std::memory_order_acq_rel)) {
+            return false;
+        }
+        const uint32_t count = Config.WorkerCount > 0 ? Config.WorkerCount : 1;
+        for (uint32_t i = 0; i < count; ++i) {
+            Workers.emplace_back(&CVHandIngestion::Run, this);
+        }
+        return true;
+    }
+
+    /// <summary> Stop the worker threads once they have finished the hand they are processing. Frames that were not
+    /// processed yet stay queued. </summary>
+    void Stop()
+    {
+        {
+            std::lock_guard<std::mutex> lock(QueueMutex);
+            if (!bRunning.exchange(false, std::memory_order_acq_rel)) {
+                return;
+            }
+            Wake.notify_all();
+        }
+        for (std::thread& worker : Workers) {
+            if (worker.joinable()) {
+                worker.join();
+            }
+        }
+        Workers.clear();
+    }
+
+    /// <summary> Returns true while the worker threads run. </summary>
+    SG_NODISCARD bool IsRunning() const
+    {
+        return bRunning.load(std::memory_order_acquire);
+    }
+
+    //--------------------------------------------------------------------------------------
+    // Posting Data (From simulations / threads)
+
+    /// <summary> Queue new CV output for processing, and return immediately. Returns false if there is no room for
+    /// another hand. </summary>
+    bool PostHandData(const CVHandTrackingData& cvData)
+    {
+        Hand* hand = FindOrAddHand(cvData.IsRight(), cvData.GetForDevice(), cvData.GetForHwVersion());
+        if (hand == nullptr) {
+            return false;
+        }
+        const std::size_t capacity = Config.QueueCapacity > 0 ? Config.QueueCapacity : 1;
+
+        std::lock_guard<std::mutex> lock(QueueMutex);
+        while (hand->Pending.size() >= capacity) {
+            hand->Pending.pop_front();
+            DroppedFrames.fetch_add(1, std::memory_order_relaxed);
+        }
+        hand->Pending.push_back(cvData);
+        if (!hand->bScheduled) {
+            hand->bScheduled = true;
+            Ready.push_back(hand);
+            Wake.notify_one();
+        }
+        return true;
+    }
+
+    /// <summary> Clear all queued frames and smoothing data. Hands that are being processed are cleared once their
+    /// worker has finished. </summary>
+    void ClearCVData()
+    {
+        const uint32_t count = HandCount.load(std::memory_order_acquire);
+        for (uint32_t i = 0; i < count; ++i) {
+            Hand& hand = *Hands[i];
+            {
+                std::lock_guard<std::mutex> lock(QueueMutex);
+                DroppedFrames.fetch_add(hand.Pending.size(), std::memory_order_relaxed);
+                hand.Pending.clear();
+            }
+            {
+                std::lock_guard<std::mutex> lock(hand.SmootherMutex);
+                hand.Smoother.reset();
+                hand.bAvailable.store(false, std::memory_order_release);
+            }
+            std::lock_guard<std::mutex> lock(hand.PoseMutex);
+            hand.bHasPose = false;
+        }
+    }
+
+    //--------------------------------------------------------------------------------------
+    // Data Access - From the simulation
+
+    /// <summary> Returns true if at least one frame was processed for a hand of a specific handedness / DeviceType /
+    /// hwVersion. </summary>
+    SG_NODISCARD bool PoseAvailable(bool bRightHanded, EDeviceType deviceType, const std::string& hardwareVersion) const
+    {
+        const Hand* hand = FindHand(bRightHanded, deviceType, hardwareVersion);
+        return hand != nullptr && hand->bAvailable.load(std::memory_order_acquire);
+    }
+
+    /// <summary> Returns true if the data was succesfully gathered. Simulation time is gathered from
+    /// CVHandLayer::GetSimulationTime(). </summary>
+    bool TryGetPose(bool bRightHanded, EDeviceType deviceType, const std::string& hardwareVersion,
+                    CVProcessedHandData& out_handData, bool bClampValues = true)
+    {
+        return TryGetPose(CVHandLayer::GetSimulationTime(), bRightHanded, deviceType, hardwareVersion, out_handData,
+                          bClampValues);
+    }
+
+    /// <summary> Returns true if the data was succesfully gathered for a custom timeStamp. Does not wait for the
+    /// workers: if the smoother of this hand is being updated, the last pose returned for it is returned again.
+    /// </summary>
+    bool TryGetPose(float currentTime, bool bRightHanded, EDeviceType deviceType, const std::string& hardwareVersion,
+                    CVProcessedHandData& out_handData, bool bClampValues = true)
+    {
+        Hand* hand = FindHand(bRightHanded, deviceType, hardwareVersion);
+        if (hand == nullptr || !hand->bAvailable.load(std::memory_order_acquire)) {
+            return false;
+        }
+
+        std::unique_lock<std::mutex> smootherLock(hand->SmootherMutex, std::try_to_lock);
+        if (smootherLock.owns_lock()) {
+            if (hand->Smoother == nullptr
+                || !hand->Smoother->GetSmoothedPose(currentTime, out_handData, bClampValues)) {
+                return false;
+            }
+            smootherLock.unlock();
+            std::lock_guard<std::mutex> poseLock(hand->PoseMutex);
+            hand->LastPose = out_handData;
+            hand->bHasPose = true;
+            return true;
+        }
+
+        std::lock_guard<std::mutex> poseLock(hand->PoseMutex);
+        if (!hand->bHasPose) {
+            return false;
+        }
+        out_handData = hand->LastPose;
+        return true;
+    }
+
+    //--------------------------------------------------------------------------------------
+    // Statistics
+
+    /// <summary> Amount of frames that were added to a smoother. </summary>
+    SG_NODISCARD uint64_t GetProcessedFrames() const
+    {
+        return ProcessedFrames.load(std::memory_order_relaxed);
+    }
+
+    /// <summary> Amount of frames that were dropped because a newer one was posted before a worker got to them, or
+    /// because the data was cleared. </summary>
+    SG_NODISCARD uint64_t GetDroppedFrames() const
+    {
+        return DroppedFrames.load(std::memory_order_relaxed);
+    }
+
+    /// <summary> Amount of distinct hands that have posted data. </summary>
+    SG_NODISCARD uint32_t GetHandCount() const
+    {
+        return HandCount.load(std::memory_order_acquire);
+    }
+
+private:
+    Hand* FindHand(bool bRightHanded, EDeviceType deviceType, const std::string& hardwareVersion) const
+    {
+        const uint32_t count = HandCount.load(std::memory_order_acquire);
+        for (uint32_t i = 0; i < count; ++i) {
+            if (Hands[i]->Matches(bRightHanded, deviceType, hardwareVersion)) {
+                return Hands[i].get();
+            }
+        }
+        return nullptr;
+    }
+
+    Hand* FindOrAddHand(bool bRightHanded, EDeviceType deviceType, const std::string& hardwareVersion)
+    {
+        Hand* hand = FindHand(bRightHanded, deviceType, hardwareVersion);
+        if (hand != nullptr) {
+            return hand;
+        }
+
+        std::lock_guard<std::mutex> lock(HandsMutex);
+        hand = FindHand(bRightHanded, deviceType, hardwareVersion);// another thread may have added it meanwhile.
+        const uint32_t count = HandCount.load(std::memory_order_relaxed);
+        if (hand != nullptr || count >= MaxHands) {
+            return hand;
+        }
+        Hands[count].reset(new Hand());
+        Hands[count]->bRightHanded = bRightHanded;
+        Hands[count]->DeviceType = deviceType;
+        Hands[count]->HardwareVersion = hardwareVersion;
+        HandCount.store(count + 1, std::memory_order_release);
+        return Hands[count].get();
+    }
+
+    void Run()
+    {
+        std::vector<CVHandTrackingData> frames;
+        std::unique_lock<std::mutex> lock(QueueMutex);
+        while (bRunning.load(std::memory_order_acquire)) {
+            if (Ready.empty()) {
+                Wake.wait(lock);
+                continue;
+            }
+            Hand* hand = Ready.front();
+            Ready.pop_front();
+
+            // Keep the hand scheduled until its queue is empty, so no other worker takes it meanwhile.
+            while (!hand->Pending.empty()) {
+                frames.clear();
+                for (CVHandTrackingData& frame : hand->Pending) {
+                    frames.push_back(std::move(frame));
+                }
+                hand->Pending.clear();
+                lock.unlock();
+                Process(*hand, frames);
+                lock.lock();
+            }
+            hand->bScheduled = false;
+        }
+    }
+
+    void Process(Hand& hand, const std::vector<CVHandTrackingData>& frames)
+    {
+        std::lock_guard<std::mutex> lock(hand.SmootherMutex);
+        for (const CVHandTrackingData& frame : frames) {
+            if (hand.Smoother == nullptr) {
+                hand.Smoother.reset(new CVHandDataSmoother(frame));
+                hand.Smoother->SetSmoothingMethod(Config.SmoothingMethod);
+            } else {
+                hand.Smoother->AddFrame(frame);
+            }
+        }
+        ProcessedFrames.fetch_add(frames.size(), std::memory_order_relaxed);
+        hand.bAvailable.store(hand.Smoother != nullptr, std::memory_order_release);
+    }
+};
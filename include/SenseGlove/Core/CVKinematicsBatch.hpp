@@ -0,0 +1,242 @@
+/**
+ * @file
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2026 SenseGlove
+ *
+ * @section DESCRIPTION
+ *
+ * Batched CVKinematics. Converts many frames of 21 CV keypoints, stored in a
+ * contiguous N x 21 x 3 float array, into wrist transforms and hand angles,
+ * spread over multiple threads. Intended for offline reprocessing of recorded
+ * CV sessions.
+ */
+
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include "CVHandTrackingData.hpp"
+#include "CVKinematics.hpp"
+#include "DeviceTypes.hpp"
+#include "Platform.hpp"
+#include "Quat.hpp"
+#include "Vect3D.hpp"
+
+namespace SGCore
+{
+    namespace CV
+    {
+        /// <summary> Runs CVKinematics on many keypoint frames at once, across multiple threads. </summary>
+        class CVKinematicsBatch;
+    }// namespace CV
+}// namespace SGCore
+
+/// <summary> Runs CVKinematics on many keypoint frames at once, across multiple threads. </summary>
+/// <remarks> Every frame is solved by CVKinematics::CalculateHandPoseData, so results are identical to those of a
+/// single CVHandTrackingData. The frames are split into one contiguous range per thread. Each thread reuses a single
+/// CVHandTrackingData and set of output objects for its whole range, overwriting their values in place, so no
+/// Vect3D or Quat is created per frame. Results are written to flat, trivially copyable structs. </remarks>
+class SGCore::CV::CVKinematicsBatch
+{
+public:
+    /// <summary> Amount of keypoints per frame, as ECVHandPoints. </summary>
+    static constexpr uint32_t PointCount = static_cast<uint32_t>(ECVHandPoints::All);
+
+    /// <summary> Amount of floats per frame in the input array. </summary>
+    static constexpr uint32_t FloatsPerFrame = PointCount * 3;
+
+    /// <summary> Amount of fingers in a hand. </summary>
+    static constexpr uint32_t MaxFingers = 5;
+
+    /// <summary> Maximum amount of hand angles per finger. </summary>
+    static constexpr uint32_t MaxJoints = 4;
+
+    /// <summary> Frames a thread should at least have to solve; fewer are not worth starting a thread for.
+    /// </summary>
+    static constexpr std::size_t MinFramesPerThread = 64;
+
+    /// <summary> Settings shared by all frames of a batch. </summary>
+    struct Settings
+    {
+        /// <summary> Whether the keypoints describe a right- or left hand. </summary>
+        bool bRightHanded = true;
+
+        /// <summary> If true, joint angles are clamped within their natural limits. </summary>
+        bool bNaturalLimits = true;
+
+        /// <summary> Certainty assigned to every frame. </summary>
+        float Certainty = 1.0f;
+
+        /// <summary> Device the keypoints were generated for. </summary>
+        EDeviceType DeviceType = EDeviceType::Unknown;
+
+        /// <summary> (Sub)hardware version the keypoints were generated for. </summary>
+        std::string HardwareVersion;
+
+        /// <summary> Maximum amount of threads, including the calling one. 0 uses all hardware threads. </summary>
+        uint32_t ThreadCount = 0;
+    };
+
+    /// <summary> The wrist transform and hand angles of a single frame. </summary>
+    /// <remarks> Indexing follows CVKinematics: fingers from thumb to pinky, joints from proximal to distal. Positions
+    /// and angles are stored as x, y, z; rotations as x, y, z, w. </remarks>
+    struct Result
+    {
+        /// <summary> True if CVKinematics could calculate this frame. </summary>
+        bool bValid;
+
+        /// <summary> Amount of valid hand angles per finger. </summary>
+        uint8_t AngleCount[MaxFingers];
+
+        /// <summary> Wrist position in world space. </summary>
+        float WristPosition[3];
+
+        /// <summary> Wrist rotation in world space. </summary>
+        float WristRotation[4];
+
+        /// <summary> Euler representation of each joint's articulation, in radians. </summary>
+        float HandAngles[MaxFingers][MaxJoints][3];
+    };
+
+private:
+    /// <summary> Objects reused by one thread for all of its frames. </summary>
+    struct Workspace
+    {
+        CVHandTrackingData Frame;
+        std::vector<Kinematics::Vect3D> Points;
+        Kinematics::Vect3D WristPosition;
+        Kinematics::Quat WristRotation;
+        std::vector<std::vector<Kinematics::Vect3D>> HandAngles;
+
+        explicit Workspace(const Settings& settings)
+            : Frame(std::vector<Kinematics::Vect3D>(PointCount), settings.Certainty, settings.bRightHanded,
+                    settings.DeviceType, settings.HardwareVersion, 0.0f),
+              Points(PointCount)
+        {
+        }
+    };
+
+public:
+    //--------------------------------------------------------------------------------------
+    // Solving
+
+    /// <summary> Solve frameCount frames of keypoints, laid out as [frame][ECVHandPoints][x, y, z], into
+    /// out_results, which must hold frameCount entries. Returns the amount of frames that could be calculated.
+    /// </summary>
+    static std::size_t Solve(const float* keypoints, std::size_t frameCount, const Settings& settings,
+                             Result* out_results)
+    {
+        if (keypoints == nullptr || out_results == nullptr || frameCount == 0) {
+            return 0;
+        }
+
+        const std::size_t threadCount = GetThreadCount(frameCount, settings);
+        const std::size_t framesPerThread = (frameCount + threadCount - 1) / threadCount;
+        std::vector<std::size_t> solved(threadCount, 0);
+        std::vector<std::thread> threads;
+        threads.reserve(threadCount - 1);
+
+        for (std::size_t t = 1; t < threadCount; ++t) {
+            const std::size_t begin = std::min(t * framesPerThread, frameCount);
+            const std::size_t end = std::min(begin + framesPerThread, frameCount);
+            threads.emplace_back([=, &settings, &solved]() {
+                solved[t] = SolveRange(keypoints, begin, end, settings, out_results);
+            });
+        }
+        solved[0] = SolveRange(keypoints, 0, std::min(framesPerThread, frameCount), settings, out_results);
+
+        std::size_t total = solved[0];
+        for (std::size_t t = 1; t < threadCount; ++t) {
+            threads[t - 1].join();
+            total += solved[t];
+        }
+        return total;
+    }
+
+    /// <summary> Solve all frames in keypoints, which must hold a multiple of FloatsPerFrame values. out_results is
+    /// resized to the amount of frames. Returns the amount of frames that could be calculated. </summary>
+    static std::size_t Solve(const std::vector<float>& keypoints, const Settings& settings,
+                             std::vector<Result>& out_results)
+    {
+        const std::size_t frameCount = keypoints.size() / FloatsPerFrame;
+        out_results.resize(frameCount);
+        return frameCount > 0 ? Solve(keypoints.data(), frameCount, settings, out_results.data()) : 0;
+    }
+
+private:
+    static std::size_t GetThreadCount(std::size_t frameCount, const Settings& settings)
+    {
+        std::size_t threadCount = settings.ThreadCount;
+        if (threadCount == 0) {
+            threadCount = std::max(std::thread::hardware_concurrency(), 1u);
+        }
+        const std::size_t minFrames = MinFramesPerThread;
+        const std::size_t worthwhile = std::max(frameCount / minFrames, static_cast<std::size_t>(1));
+        return std::min(threadCount, worthwhile);
+    }
+
+    static std::size_t SolveRange(const float* keypoints, std::size_t begin, std::size_t end,
+                                  const Settings& settings, Result* out_results)
+    {
+        if (begin >= end) {
+            return 0;
+        }
+        Workspace workspace(settings);
+        std::size_t solved = 0;
+        for (std::size_t i = begin; i < end; ++i) {
+            if (SolveFrame(keypoints + i * FloatsPerFrame, settings, workspace, out_results[i])) {
+                ++solved;
+            }
+        }
+        return solved;
+    }
+
+    static bool SolveFrame(const float* frame, const Settings& settings, Workspace& workspace, Result& out_result)
+    {
+        for (uint32_t p = 0; p < PointCount; ++p) {
+            workspace.Points[p].SetX(frame[p * 3]);
+            workspace.Points[p].SetY(frame[p * 3 + 1]);
+            workspace.Points[p].SetZ(frame[p * 3 + 2]);
+        }
+        workspace.Frame.SetJointPositions(workspace.Points);
+
+        out_result.bValid = CVKinematics::CalculateHandPoseData(workspace.Frame, workspace.WristPosition,
+                                                                 workspace.WristRotation, workspace.HandAngles,
+                                                                 settings.bNaturalLimits);
+        out_result.WristPosition[0] = workspace.WristPosition.GetX();
+        out_result.WristPosition[1] = workspace.WristPosition.GetY();
+        out_result.WristPosition[2] = workspace.WristPosition.GetZ();
+        out_result.WristRotation[0] = workspace.WristRotation.GetX();
+        out_result.WristRotation[1] = workspace.WristRotation.GetY();
+        out_result.WristRotation[2] = workspace.WristRotation.GetZ();
+        out_result.WristRotation[3] = workspace.WristRotation.GetW();
+
+        const std::size_t fingerCount = std::min(workspace.HandAngles.size(), static_cast<std::size_t>(MaxFingers));
+        for (std::size_t f = 0; f < MaxFingers; ++f) {
+            const std::size_t jointCount = f < fingerCount
+                                               ? std::min(workspace.HandAngles[f].size(),
+                                                          static_cast<std::size_t>(MaxJoints))
+                                               : 0;
+            out_result.AngleCount[f] = static_cast<uint8_t>(jointCount);
+            for (std::size_t j = 0; j < jointCount; ++j) {
+                const Kinematics::Vect3D& angle = workspace.HandAngles[f][j];
+                out_result.HandAngles[f][j][0] = angle.GetX();
+                out_result.HandAngles[f][j][1] = angle.GetY();
+                out_result.HandAngles[f][j][2] = angle.GetZ();
+            }
+        }
+        return out_result.bValid;
+    }
+};
+
+static_assert(std::is_trivially_copyable<SGCore::CV::CVKinematicsBatch::Result>::value,
+              "CVKinematicsBatch::Result is written in bulk and must remain trivially copyable.");
@@ -0,0 +1,214 @@
+/**
+ * @file
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2026 SenseGlove
+ *
+ * @section DESCRIPTION
+ *
+ * A fixed-size, flat alternative to CVProcessedHandData. The wrist transform
+ * and hand angles live in arrays inside the struct itself, so frames can be
+ * stored, copied and interpolated without touching the heap.
+ */
+
+
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+#include "CVKinematicsBatch.hpp"
+#include "CVProcessedHandData.hpp"
+#include "Platform.hpp"
+#include "Quat.hpp"
+#include "Vect3D.hpp"
+
+namespace SGCore
+{
+    namespace CV
+    {
+        /// <summary> A fixed-size, flat alternative to CVProcessedHandData that never allocates. </summary>
+        struct FlatCVHandData;
+    }// namespace CV
+}// namespace SGCore
+
+/// <summary> A fixed-size, flat alternative to CVProcessedHandData that never allocates. </summary>
+/// <remarks> Indexing follows CVProcessedHandData: fingers from thumb to pinky, joints from proximal to distal.
+/// Positions and angles are stored as x, y, z; rotations as x, y, z, w. </remarks>
+struct SGCore::CV::FlatCVHandData
+{
+public:
+    /// <summary> Amount of fingers in a hand. </summary>
+    static constexpr uint32_t MaxFingers = CVKinematicsBatch::MaxFingers;
+
+    /// <summary> Maximum amount of hand angles per finger. </summary>
+    static constexpr uint32_t MaxJoints = CVKinematicsBatch::MaxJoints;
+
+public:
+    /// <summary> Whether this data was generated for a right- or left hand. </summary>
+    bool bRightHanded;
+
+    /// <summary> True once this data has been filled in. </summary>
+    bool bValid;
+
+    /// <summary> Amount of valid hand angles per finger. </summary>
+    uint8_t AngleCount[MaxFingers];
+
+    /// <summary> Simulation time of this data, used for smoothing. </summary>
+    float Timestamp;
+
+    /// <summary> Certainty of the whole hand tracking. </summary>
+    float GlobalCertainty;
+
+    /// <summary> Wrist position in world space. </summary>
+    float WristPosition[3];
+
+    /// <summary> Wrist rotation in world space. </summary>
+    float WristRotation[4];
+
+    /// <summary> Euler representation of each joint's articulation, in radians. </summary>
+    float HandAngles[MaxFingers][MaxJoints][3];
+
+public:
+    /// <summary> Reset this data to an empty, invalid state. </summary>
+    void Clear()
+    {
+        std::memset(this, 0, sizeof(FlatCVHandData));
+    }
+
+    /// <summary> Copy the values of a CVProcessedHandData into this flat representation. Does not allocate. Returns
+    /// false if it contains more fingers or joints than fit in this struct; those are then dropped. </summary>
+    bool CopyFrom(const CVProcessedHandData& data)
+    {
+        Clear();
+        bRightHanded = data.IsRight();
+        Timestamp = data.GetTimestamp();
+        GlobalCertainty = data.GetGlobalCertainty();
+        const Kinematics::Vect3D& position = data.GetWristWorldPosition();
+        WristPosition[0] = position.GetX();
+        WristPosition[1] = position.GetY();
+        WristPosition[2] = position.GetZ();
+        const Kinematics::Quat& rotation = data.GetWristWorldRotation();
+        WristRotation[0] = rotation.GetX();
+        WristRotation[1] = rotation.GetY();
+        WristRotation[2] = rotation.GetZ();
+        WristRotation[3] = rotation.GetW();
+
+        const uint32_t maxFingers = MaxFingers;
+        const uint32_t maxJoints = MaxJoints;
+        const std::vector<std::vector<Kinematics::Vect3D>>& angles = data.GetHandAngles();
+        bool bFits = angles.size() <= maxFingers;
+        for (uint32_t f = 0; f < maxFingers && f < angles.size(); ++f) {
+            const std::vector<Kinematics::Vect3D>& finger = angles[f];
+            bFits = bFits && finger.size() <= maxJoints;
+            const uint32_t count = finger.size() < maxJoints ? static_cast<uint32_t>(finger.size()) : maxJoints;
+            for (uint32_t j = 0; j < count; ++j) {
+                HandAngles[f][j][0] = finger[j].GetX();
+                HandAngles[f][j][1] = finger[j].GetY();
+                HandAngles[f][j][2] = finger[j].GetZ();
+            }
+            AngleCount[f] = static_cast<uint8_t>(count);
+        }
+        bValid = true;
+        return bFits;
+    }
+
+    /// <summary> Copy a frame solved by CVKinematicsBatch into this flat representation. </summary>
+    void CopyFrom(const CVKinematicsBatch::Result& result, bool bRight, float timestamp, float certainty)
+    {
+        bRightHanded = bRight;
+        bValid = result.bValid;
+        Timestamp = timestamp;
+        GlobalCertainty = certainty;
+        std::memcpy(AngleCount, result.AngleCount, sizeof(AngleCount));
+        std::memcpy(WristPosition, result.WristPosition, sizeof(WristPosition));
+        std::memcpy(WristRotation, result.WristRotation, sizeof(WristRotation));
+        std::memcpy(HandAngles, result.HandAngles, sizeof(HandAngles));
+    }
+
+    /// <summary> Convert this flat representation back into a CVProcessedHandData, e.g. to create a HandPose.
+    /// </summary>
+    /// <remarks> Allocates; intended for interop, not for the hot path. </remarks>
+    SG_NODISCARD CVProcessedHandData ToProcessedData() const
+    {
+        std::vector<std::vector<Kinematics::Vect3D>> angles(MaxFingers);
+        for (uint32_t f = 0; f < MaxFingers; ++f) {
+            for (uint32_t j = 0; j < AngleCount[f]; ++j) {
+                angles[f].emplace_back(HandAngles[f][j][0], HandAngles[f][j][1], HandAngles[f][j][2]);
+            }
+        }
+        return CVProcessedHandData(bRightHanded,
+                                   Kinematics::Vect3D(WristPosition[0], WristPosition[1], WristPosition[2]),
+                                   Kinematics::Quat(WristRotation[0], WristRotation[1], WristRotation[2],
+                                                    WristRotation[3]),
+                                   angles, GlobalCertainty, Timestamp);
+    }
+
+    /// <summary> Interpolate between p0 (t = 0) and p1 (t = 1) into out_data, which may be either of them. t outside
+    /// [0 .. 1] extrapolates, unless bClampOutput is set. The wrist rotation is spherically interpolated; everything
+    /// else linearly. Handedness and angle counts are taken from p1. Does not allocate. </summary>
+    static void Interpolate(float t, const FlatCVHandData& p0, const FlatCVHandData& p1, bool bClampOutput,
+                            FlatCVHandData& out_data)
+    {
+        if (bClampOutput) {
+            t = t < 0.0f ? 0.0f : (t > 1.0f ? 1.0f : t);
+        }
+        out_data.bRightHanded = p1.bRightHanded;
+        out_data.bValid = p0.bValid && p1.bValid;
+        out_data.Timestamp = Lerp(p0.Timestamp, p1.Timestamp, t);
+        out_data.GlobalCertainty = Lerp(p0.GlobalCertainty, p1.GlobalCertainty, t);
+        for (uint32_t i = 0; i < 3; ++i) {
+            out_data.WristPosition[i] = Lerp(p0.WristPosition[i], p1.WristPosition[i], t);
+        }
+        Slerp(p0.WristRotation, p1.WristRotation, t, out_data.WristRotation);
+        for (uint32_t f = 0; f < MaxFingers; ++f) {
+            out_data.AngleCount[f] = p1.AngleCount[f];
+            for (uint32_t j = 0; j < MaxJoints; ++j) {
+                for (uint32_t i = 0; i < 3; ++i) {
+                    out_data.HandAngles[f][j][i] = Lerp(p0.HandAngles[f][j][i], p1.HandAngles[f][j][i], t);
+                }
+            }
+        }
+    }
+
+private:
+    static float Lerp(float from, float to, float t)
+    {
+        return from + (to - from) * t;
+    }
+
+    /// <summary> Spherical interpolation along the shortest arc, falling back to a normalized lerp for nearly
+    /// identical rotations. Extrapolates along the same arc for t outside [0 .. 1]. </summary>
+    static void Slerp(const float (&q0)[4], const float (&q1)[4], float t, float (&out_q)[4])
+    {
+        float dot = q0[0] * q1[0] + q0[1] * q1[1] + q0[2] * q1[2] + q0[3] * q1[3];
+        const float sign = dot < 0.0f ? -1.0f : 1.0f;
+        dot *= sign;
+
+        float w0 = 1.0f - t;
+        float w1 = t * sign;
+        if (dot < 0.9995f) {
+            const float theta = std::acos(dot);
+            const float sinTheta = std::sin(theta);
+            w0 = std::sin((1.0f - t) * theta) / sinTheta;
+            w1 = std::sin(t * theta) / sinTheta * sign;
+        }
+        float lengthSquared = 0.0f;
+        float result[4];
+        for (uint32_t i = 0; i < 4; ++i) {
+            result[i] = w0 * q0[i] + w1 * q1[i];
+            lengthSquared += result[i] * result[i];
+        }
+        const float scale = lengthSquared > 0.0f ? 1.0f / std::sqrt(lengthSquared) : 0.0f;
+        for (uint32_t i = 0; i < 4; ++i) {
+            out_q[i] = result[i] * scale;
+        }
+    }
+};
+
+static_assert(std::is_trivially_copyable<SGCore::CV::FlatCVHandData>::value,
+              "FlatCVHandData must remain trivially copyable so it can be stored and passed without allocations.");
@@ -0,0 +1,220 @@
+/**
+ * @file
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2026 SenseGlove
+ *
+ * @section DESCRIPTION
+ *
+ * An allocation-free alternative to CVHandDataSmoother. Keeps a history of
+ * FlatCVHandData in a fixed-capacity ring, and writes smoothed poses into
+ * caller-provided storage, so it can be queried at high rates (e.g. 1 kHz)
+ * without heap churn. Incoming frames can be filtered with a One-Euro or
+ * Kalman filter before they are stored.
+ */
+
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "CVHandDataSmoother.hpp"
+#include "CVHandFilter.hpp"
+#include "CVHandTrackingData.hpp"
+#include "CVKinematics.hpp"
+#include "CVProcessedHandData.hpp"
+#include "FlatCVHandData.hpp"
+#include "Platform.hpp"
+
+namespace SGCore
+{
+    namespace CV
+    {
+        /// <summary> Keeps a fixed-capacity history of FlatCVHandData and smooths it without allocating. </summary>
+        class FlatCVHandDataSmoother;
+    }// namespace CV
+}// namespace SGCore
+
+/// <summary> Keeps a fixed-capacity history of FlatCVHandData and smooths it without allocating. </summary>
+/// <remarks> The ring is allocated once, in the constructor; adding frames overwrites the oldest one once it is full,
+/// and GetSmoothedPose writes into the caller's FlatCVHandData. GetSmoothedPose does not modify the smoother, so it
+/// can be called any number of times per frame. Like CVHandDataSmoother, this class is not thread-safe. Frames must be
+/// added in chronological order. If a filter method is set, frames are filtered as they are added, so the history
+/// holds filtered frames; combine it with ESmoothingMethod::None for the lowest latency. </remarks>
+class SGCore::CV::FlatCVHandDataSmoother
+{
+public:
+    /// <summary> Amount of frames kept unless specified otherwise. </summary>
+    static constexpr uint32_t DefaultDepth = 8;
+
+    /// <summary> How far ExtrapolateAhead may predict when clamping, in intervals between the last two frames.
+    /// </summary>
+    static constexpr float MaxClampedExtrapolation = 1.0f;
+
+private:
+    std::vector<FlatCVHandData> Frames;
+    uint32_t Newest = 0;
+    uint32_t Count = 0;
+    ESmoothingMethod SmoothingMethod = ESmoothingMethod::InterpolateBehind;
+    CVHandFilter Filter;
+
+public:
+    /// <summary> Create a smoother that keeps the last depth frames, at least 2. </summary>
+    explicit FlatCVHandDataSmoother(uint32_t depth = DefaultDepth,
+                                    ESmoothingMethod method = ESmoothingMethod::InterpolateBehind)
+        : Frames(depth > 2 ? depth : 2), SmoothingMethod(method)
+    {
+    }
+
+    ~FlatCVHandDataSmoother() = default;
+
+public:
+    //--------------------------------------------------------------------------------------
+    // Accessors
+
+    /// <summary> The way in which we're smoothing the incoming data. </summary>
+    SG_NODISCARD ESmoothingMethod GetSmoothingMethod() const
+    {
+        return SmoothingMethod;
+    }
+
+    void SetSmoothingMethod(ESmoothingMethod method)
+    {
+        SmoothingMethod = method;
+    }
+
+    /// <summary> The filter applied to incoming frames. </summary>
+    SG_NODISCARD ECVFilterMethod GetFilterMethod() const
+    {
+        return Filter.GetMethod();
+    }
+
+    void SetFilterMethod(ECVFilterMethod method)
+    {
+        Filter.SetMethod(method);
+    }
+
+    /// <summary> Filter parameters. Changing the method resets the filter. </summary>
+    SG_NODISCARD const CVHandFilter::Settings& GetFilterSettings() const
+    {
+        return Filter.GetSettings();
+    }
+
+    void SetFilterSettings(const CVHandFilter::Settings& settings)
+    {
+        Filter.SetSettings(settings);
+    }
+
+    /// <summary> Maximum amount of frames kept. </summary>
+    SG_NODISCARD uint32_t GetDepth() const
+    {
+        return static_cast<uint32_t>(Frames.size());
+    }
+
+    /// <summary> The amount of frames currently in this smoother (0 .. GetDepth()). </summary>
+    SG_NODISCARD uint32_t GetFrameCount() const
+    {
+        return Count;
+    }
+
+    /// <summary> Frame at index, where 0 is the newest. Returns nullptr if there is no such frame. </summary>
+    SG_NODISCARD const FlatCVHandData* GetFrame(uint32_t index) const
+    {
+        if (index >= Count) {
+            return nullptr;
+        }
+        const uint32_t depth = GetDepth();
+        return &Frames[(Newest + depth - index) % depth];
+    }
+
+    /// <summary> Clear smoothing data and filter state. Keeps the allocated ring. </summary>
+    void ClearFrames()
+    {
+        Newest = 0;
+        Count = 0;
+        Filter.Reset();
+    }
+
+    //--------------------------------------------------------------------------------------
+    // Member Functions
+
+    /// <summary> Filter a processed frame and add it. Returns false, and ignores the frame, if it is invalid or older
+    /// than the newest frame. </summary>
+    bool AddFrame(const FlatCVHandData& frame)
+    {
+        if (!frame.bValid || (Count > 0 && frame.Timestamp < GetFrame(0)->Timestamp)) {
+            return false;
+        }
+        const uint32_t depth = GetDepth();
+        Newest = Count > 0 ? (Newest + 1) % depth : 0;
+        Frames[Newest] = frame;
+        Filter.Apply(Frames[Newest]);
+        if (Count < depth) {
+            ++Count;
+        }
+        return true;
+    }
+
+    /// <summary> Add a frame processed by the library. Copies it without allocating. </summary>
+    bool AddFrame(const CVProcessedHandData& frame)
+    {
+        FlatCVHandData flat;
+        flat.CopyFrom(frame);
+        return AddFrame(flat);
+    }
+
+    /// <summary> Convert raw CV output with CVKinematics, and add the result. </summary>
+    /// <remarks> The conversion itself happens inside the library and may allocate; one CVProcessedHandData is
+    /// re-used per thread. </remarks>
+    bool AddFrame(const CVHandTrackingData& cvData, bool bNaturalLimits = true)
+    {
+        static thread_local CVProcessedHandData scratch;
+        return CVKinematics::CalculateTrackingData(cvData, scratch, bNaturalLimits) && AddFrame(scratch);
+    }
+
+    /// <summary> Smoothed hand data at currentTime, based on the frames in this smoother, written into
+    /// out_smoothedData. Does not allocate. Returns false if there are no frames. </summary>
+    /// <param name="currentTime"> Time at which this data is requested, used to interpolate / extrapolate. </param>
+    /// <param name="out_smoothedData"> Output: Smoothed Hand Data. Its Timestamp is set to currentTime. </param>
+    /// <param name="bClampValues"> If true, InterpolateBehind stays between the frames it has, and ExtrapolateAhead
+    /// predicts at most MaxClampedExtrapolation intervals beyond the newest frame. </param>
+    bool GetSmoothedPose(float currentTime, FlatCVHandData& out_smoothedData, bool bClampValues = true) const
+    {
+        if (Count == 0) {
+            return false;
+        }
+        const FlatCVHandData& newest = *GetFrame(0);
+        if (Count == 1 || SmoothingMethod == ESmoothingMethod::None) {
+            out_smoothedData = newest;
+        } else if (SmoothingMethod == ESmoothingMethod::ExtrapolateAhead) {
+            const FlatCVHandData& previous = *GetFrame(1);
+            float t = GetT(previous, newest, currentTime);
+            const float maxT = 1.0f + MaxClampedExtrapolation;
+            if (bClampValues) {
+                t = t < 0.0f ? 0.0f : (t > maxT ? maxT : t);
+            }
+            FlatCVHandData::Interpolate(t, previous, newest, false, out_smoothedData);
+        } else {
+            // Run one interval behind, so there is (almost) always a pair of frames around the requested time.
+            const float behind = currentTime - (newest.Timestamp - GetFrame(1)->Timestamp);
+            uint32_t index = 1;
+            while (index + 1 < Count && GetFrame(index)->Timestamp > behind) {
+                ++index;
+            }
+            const FlatCVHandData& from = *GetFrame(index);
+            const FlatCVHandData& to = *GetFrame(index - 1);
+            FlatCVHandData::Interpolate(GetT(from, to, behind), from, to, bClampValues, out_smoothedData);
+        }
+        out_smoothedData.Timestamp = currentTime;
+        return true;
+    }
+
+private:
+    static float GetT(const FlatCVHandData& from, const FlatCVHandData& to, float time)
+    {
+        const float interval = to.Timestamp - from.Timestamp;
+        return interval > 0.0f ? (time - from.Timestamp) / interval : 1.0f;
+    }
+};
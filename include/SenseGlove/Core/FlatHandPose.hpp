@@ -0,0 +1,170 @@
+/**
+ * @file
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2026 SenseGlove
+ *
+ * @section DESCRIPTION
+ *
+ * A fixed-size, flat alternative to HandPose. All joint positions, rotations
+ * and hand angles live in contiguous arrays inside the struct itself, so it can
+ * be created, copied and passed between threads without touching the heap.
+ */
+
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+#include "BasicHandModel.hpp"
+#include "HandPose.hpp"
+#include "PipelineLatency.hpp"
+#include "Platform.hpp"
+#include "Quat.hpp"
+#include "Vect3D.hpp"
+
+namespace SGCore
+{
+    /// <summary> A fixed-size, flat alternative to HandPose that never allocates. </summary>
+    struct FlatHandPose;
+}// namespace SGCore
+
+/// <summary> A fixed-size, flat alternative to HandPose that never allocates. </summary>
+/// <remarks> Indexing follows HandPose: fingers from thumb to pinky, joints from proximal to distal. Positions and
+/// angles are stored as x, y, z; rotations as x, y, z, w. </remarks>
+struct SGCore::FlatHandPose
+{
+public:
+    /// <summary> Amount of fingers in a hand. </summary>
+    static constexpr uint32_t MaxFingers = 5;
+
+    /// <summary> Maximum amount of joints (including the fingertip) per finger. </summary>
+    static constexpr uint32_t MaxJoints = 4;
+
+public:
+    /// <summary> Whether this pose was created for a right- or left hand. </summary>
+    bool bRightHanded;
+
+    /// <summary> True once this pose has been filled with data. </summary>
+    bool bValid;
+
+    /// <summary> Amount of valid joint positions and rotations per finger. </summary>
+    uint8_t JointCount[MaxFingers];
+
+    /// <summary> Amount of valid hand angles per finger. </summary>
+    uint8_t AngleCount[MaxFingers];
+
+    /// <summary> Joint positions relative to the glove origin, in mm. </summary>
+    float JointPositions[MaxFingers][MaxJoints][3];
+
+    /// <summary> Joint rotations relative to the glove origin. </summary>
+    float JointRotations[MaxFingers][MaxJoints][4];
+
+    /// <summary> Euler representation of each joint's articulation, in radians. </summary>
+    float HandAngles[MaxFingers][MaxJoints][3];
+
+    /// <summary> When the sample this pose was calculated from passed each stage of the pipeline. Filled in by
+    /// HandPoseCache; all 0 otherwise. </summary>
+    Util::PipelineTimestamps Timestamps;
+
+public:
+    /// <summary> Reset this pose to an empty, invalid state. </summary>
+    void Clear()
+    {
+        std::memset(this, 0, sizeof(FlatHandPose));
+    }
+
+    /// <summary> Copy the values of a HandPose into this flat representation. Does not allocate. Returns false if
+    /// the HandPose contains more fingers or joints than fit in this struct; those are then dropped. </summary>
+    bool CopyFrom(const HandPose& handPose)
+    {
+        Clear();
+        bRightHanded = handPose.IsRight();
+        bool bFits = CopyVectors(handPose.GetJointPositions(), JointPositions, JointCount);
+        bFits = CopyQuats(handPose.GetJointRotations()) && bFits;
+        bFits = CopyVectors(handPose.GetHandAngles(), HandAngles, AngleCount) && bFits;
+        bValid = true;
+        return bFits;
+    }
+
+    /// <summary> Replace this pose by the hand angles of a hand, e.g. from HapticGlove::GetHandAngles. Joint positions
+    /// and rotations are cleared; see JointKinematicsBatch to calculate them. Does not allocate. Returns false if
+    /// there are more fingers or joints than fit in this struct; those are then dropped. </summary>
+    bool CopyHandAnglesFrom(const std::vector<std::vector<Kinematics::Vect3D>>& handAngles, bool bRightHand)
+    {
+        Clear();
+        bRightHanded = bRightHand;
+        const bool bFits = CopyVectors(handAngles, HandAngles, AngleCount);
+        bValid = true;
+        return bFits;
+    }
+
+    /// <summary> Convert this flat representation back into a HandPose, e.g. to use any of its utility functions.
+    /// </summary>
+    /// <remarks> Allocates; intended for interop, not for the hot path. </remarks>
+    SG_NODISCARD HandPose ToHandPose() const
+    {
+        std::vector<std::vector<Kinematics::Vect3D>> positions(MaxFingers);
+        std::vector<std::vector<Kinematics::Quat>> rotations(MaxFingers);
+        std::vector<std::vector<Kinematics::Vect3D>> angles(MaxFingers);
+        for (uint32_t f = 0; f < MaxFingers; ++f) {
+            for (uint32_t j = 0; j < JointCount[f]; ++j) {
+                positions[f].emplace_back(JointPositions[f][j][0], JointPositions[f][j][1], JointPositions[f][j][2]);
+                rotations[f].emplace_back(JointRotations[f][j][0], JointRotations[f][j][1],
+                                          JointRotations[f][j][2], JointRotations[f][j][3]);
+            }
+            for (uint32_t j = 0; j < AngleCount[f]; ++j) {
+                angles[f].emplace_back(HandAngles[f][j][0], HandAngles[f][j][1], HandAngles[f][j][2]);
+            }
+        }
+        return HandPose(bRightHanded, positions, rotations, angles);
+    }
+
+private:
+    static bool CopyVectors(const std::vector<std::vector<Kinematics::Vect3D>>& source,
+                            float (&out_target)[MaxFingers][MaxJoints][3], uint8_t (&out_counts)[MaxFingers])
+    {
+        const uint32_t maxFingers = MaxFingers;
+        const uint32_t maxJoints = MaxJoints;
+        bool bFits = source.size() <= maxFingers;
+        for (uint32_t f = 0; f < maxFingers && f < source.size(); ++f) {
+            const std::vector<Kinematics::Vect3D>& finger = source[f];
+            bFits = bFits && finger.size() <= maxJoints;
+            const uint32_t count = finger.size() < maxJoints ? static_cast<uint32_t>(finger.size()) : maxJoints;
+            for (uint32_t j = 0; j < count; ++j) {
+                out_target[f][j][0] = finger[j].GetX();
+                out_target[f][j][1] = finger[j].GetY();
+                out_target[f][j][2] = finger[j].GetZ();
+            }
+            out_counts[f] = static_cast<uint8_t>(count);
+        }
+        return bFits;
+    }
+
+    bool CopyQuats(const std::vector<std::vector<Kinematics::Quat>>& source)
+    {
+        const uint32_t maxFingers = MaxFingers;
+        bool bFits = source.size() <= maxFingers;
+        for (uint32_t f = 0; f < maxFingers && f < source.size(); ++f) {
+            const std::vector<Kinematics::Quat>& finger = source[f];
+            // Rotations are stored alongside positions, so they share JointCount.
+            bFits = bFits && finger.size() == JointCount[f];
+            const uint32_t count = finger.size() < JointCount[f] ? static_cast<uint32_t>(finger.size()) : JointCount[f];
+            for (uint32_t j = 0; j < count; ++j) {
+                JointRotations[f][j][0] = finger[j].GetX();
+                JointRotations[f][j][1] = finger[j].GetY();
+                JointRotations[f][j][2] = finger[j].GetZ();
+                JointRotations[f][j][3] = finger[j].GetW();
+            }
+            JointCount[f] = static_cast<uint8_t>(count);
+        }
+        return bFits;
+    }
+};
+
+static_assert(std::is_trivially_copyable<SGCore::FlatHandPose>::value,
+              "FlatHandPose must remain trivially copyable so it can be stored and passed without allocations.");
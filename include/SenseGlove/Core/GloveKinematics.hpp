@@ -0,0 +1,86 @@
+/**
+ * @file
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2026 SenseGlove
+ *
+ * @section DESCRIPTION
+ *
+ * Reads the hand angles of a HapticGlove into a FlatHandPose, and calculates
+ * the joint positions and rotations with JointKinematicsBatch, instead of
+ * building a HandPose inside the library.
+ */
+
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "BasicHandModel.hpp"
+#include "FlatHandPose.hpp"
+#include "HapticGlove.hpp"
+#include "JointKinematicsBatch.hpp"
+#include "Platform.hpp"
+#include "Vect3D.hpp"
+
+namespace SGCore
+{
+    namespace Kinematics
+    {
+        /// <summary> Retrieve only the hand angles of a glove into a flat, caller-owned structure; joint positions and
+        /// rotations are cleared. </summary>
+        /// <remarks> The hand angles are read through HapticGlove::GetHandAngles into a buffer that is re-used per
+        /// thread; whether that call allocates is up to the glove. Returns false, and marks out_handPose invalid, if
+        /// the glove has no hand angles. </remarks>
+        inline bool GetFlatHandAngles(const HapticGlove& glove, FlatHandPose& out_handPose)
+        {
+            static thread_local std::vector<std::vector<Vect3D>> handAngles;
+            if (!glove.GetHandAngles(handAngles)) {
+                out_handPose.bValid = false;
+                return false;
+            }
+            out_handPose.CopyHandAnglesFrom(handAngles, glove.IsRight());
+            return true;
+        }
+
+        /// <summary> Retrieve the hand pose of a glove into a flat, caller-owned structure: its hand angles, and the
+        /// joint positions and rotations that follow from them with handGeometry. </summary>
+        /// <remarks> The forward kinematics and the output never allocate; the hand angles are read as in
+        /// GetFlatHandAngles. Returns false, and marks out_handPose invalid, if the glove has no hand angles.
+        /// </remarks>
+        inline bool GetFlatHandPose(const HapticGlove& glove, const JointKinematicsBatch::HandGeometry& handGeometry,
+                                    FlatHandPose& out_handPose)
+        {
+            if (!GetFlatHandAngles(glove, out_handPose)) {
+                return false;
+            }
+            JointKinematicsBatch::ForwardKinematics(handGeometry, out_handPose, out_handPose);
+            return true;
+        }
+
+        /// <summary> Hand geometry of BasicHandModel::Default: the default hand geometry that
+        /// HandPose::FromHandAngles(handAngles, bRightHanded) and HapticGlove::GetHandPose(HandPose&) use. It is
+        /// created once per thread and hand. </summary>
+        inline const JointKinematicsBatch::HandGeometry& GetDefaultHandGeometry(bool bRightHand)
+        {
+            static thread_local JointKinematicsBatch::HandGeometry defaultGeometry[2];
+            static thread_local bool bHasDefaultGeometry[2] = {false, false};
+            const uint32_t hand = bRightHand ? 1 : 0;
+            if (!bHasDefaultGeometry[hand]) {
+                const BasicHandModel model = BasicHandModel::Default(bRightHand);
+                defaultGeometry[hand] = JointKinematicsBatch::HandGeometry::FromModel(model);
+                bHasDefaultGeometry[hand] = true;
+            }
+            return defaultGeometry[hand];
+        }
+
+        /// <summary> As GetFlatHandPose(glove, handGeometry, out_handPose), with the default hand geometry of the
+        /// glove's hand; see GetDefaultHandGeometry. </summary>
+        inline bool GetFlatHandPose(const HapticGlove& glove, FlatHandPose& out_handPose)
+        {
+            return GetFlatHandPose(glove, GetDefaultHandGeometry(glove.IsRight()), out_handPose);
+        }
+    }// namespace Kinematics
+}// namespace SGCore
@@ -0,0 +1,323 @@
+/**
+ * @file
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2026 SenseGlove
+ *
+ * @section DESCRIPTION
+ *
+ * Remembers the last HandPose calculated for a glove, together with the
+ * sensor sample it was calculated from: its sequence number when known, or
+ * else the raw sensor data string. As long as no new sample arrives, the
+ * remembered pose is returned instead of running normalization, interpolation
+ * and forward kinematics again.
+ */
+
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "BasicHandModel.hpp"
+#include "DeviceList.hpp"
+#include "FlatHandPose.hpp"
+#include "HandPose.hpp"
+#include "HapticGlove.hpp"
+#include "MetricsRegistry.hpp"
+#include "PipelineLatency.hpp"
+#include "Platform.hpp"
+#include "SGDevice.hpp"
+#include "SensorChannel.hpp"
+#include "SensorFrame.hpp"
+
+namespace SGCore
+{
+    /// <summary> Per-glove cache of the last calculated HandPose, keyed on the sensor sample it was calculated from.
+    /// </summary>
+    class HandPoseCache;
+}// namespace SGCore
+
+/// <summary> Per-glove cache of the last calculated HandPose, keyed on the sensor sample it was calculated from.
+/// </summary>
+/// <remarks> Useful when rendering faster than the glove sends packets: only the first call after a new sample
+/// runs the kinematic pipeline; all other calls are hits. When a sequence number is known, either from the caller or
+/// from the glove's SensorChannel once AttachSensorChannel succeeded, it identifies the sample without any further
+/// work. A sequence number of 0 means "unknown"; the cache then reads the glove's raw sensor data string from
+/// SenseCom through DeviceList::GetSensorDataString, and compares it to the one of the cached pose. Calibration or
+/// profile changes do not produce a new sample, so call Invalidate() after EndCalibration,
+/// ResetCalibration or TryLoadProfile. Not thread-safe, except for the hit/miss counters, which may be read from
+/// any thread. </remarks>
+class SGCore::HandPoseCache
+{
+private:
+    /// <summary> Exposes SGDevice's protected IPC address, needed to read the raw sensor data. Never instantiated.
+    /// </summary>
+    struct IpcAddressAccess : public SGDevice
+    {
+        static const std::string& Get(const SGDevice& device)
+        {
+            return (device.*(&IpcAddressAccess::GetIpcAddress))();
+        }
+    };
+
+private:
+    std::shared_ptr<HapticGlove> Glove;
+    Util::SensorChannel Channel;
+
+    HandPose CachedPose;
+    FlatHandPose CachedFlatPose;
+    uint64_t CachedSequence = 0;
+    bool bCachedValid = false;
+
+    /// <summary> Raw sensor data the cached pose was calculated from, if it was cached without a sequence number.
+    /// </summary>
+    std::string CachedSensorData;
+    bool bCachedBySensorData = false;
+
+    /// <summary> Buffer for the raw sensor data read on each call without a sequence number. </summary>
+    std::string LatestSensorData;
+
+    /// <summary> Hand geometry the cached pose was calculated with; only used by the BasicHandModel overloads.
+    /// </summary>
+    Kinematics::BasicHandModel CachedGeometry;
+    bool bCachedWithGeometry = false;
+
+    std::atomic<uint64_t> Hits{0};
+    std::atomic<uint64_t> Misses{0};
+
+    Util::SensorFrame LatestFrame;
+    Util::PipelineLatencyStats Latency;
+
+    /// <summary> Metrics of the glove, looked up once. nullptr if there is no glove. </summary>
+    Diagnostics::DeviceMetrics* Metrics = nullptr;
+
+public:
+    explicit HandPoseCache(std::shared_ptr<HapticGlove> glove)
+        : Glove(std::move(glove))
+    {
+        CachedFlatPose.Clear();
+        LatestFrame.Clear();
+        if (Glove != nullptr) {
+            Metrics = &Diagnostics::MetricsRegistry::ForDevice(Glove->GetDeviceIndex());
+        }
+    }
+
+    HandPoseCache(const HandPoseCache& rhs) = delete;
+
+    ~HandPoseCache() = default;
+
+public:
+    HandPoseCache& operator=(const HandPoseCache& rhs) = delete;
+
+public:
+    /// <summary> The glove whose poses are cached. </summary>
+    SG_NODISCARD const std::shared_ptr<HapticGlove>& GetGlove() const
+    {
+        return Glove;
+    }
+
+    /// <summary> Read sample sequence numbers from the glove's SensorChannel, so that the overloads without a
+    /// sequence number can be used. Returns false if no writer publishes frames for this glove. </summary>
+    bool AttachSensorChannel()
+    {
+        return Glove != nullptr && Channel.OpenReader(Glove->GetDeviceIndex());
+    }
+
+    /// <summary> Sequence number of the latest sample, as published to the glove's SensorChannel. 0 if the channel
+    /// is not attached. </summary>
+    SG_NODISCARD uint64_t GetLatestSequence() const
+    {
+        return Channel.GetLatestSequence();
+    }
+
+    /// <summary> Forget the cached pose, so that the next call recalculates it. </summary>
+    void Invalidate()
+    {
+        bCachedValid = false;
+        CachedSequence = 0;
+        bCachedBySensorData = false;
+    }
+
+    //--------------------------------------------------------------------------------------
+    // Hand Poses
+
+    /// <summary> Retrieve the glove's HandPose, re-using the cached one if sequence has not changed since it was
+    /// calculated. If sequence is 0, the glove's raw sensor data is compared instead. Returns false if the glove could
+    /// not calculate a pose. </summary>
+    bool GetHandPose(uint64_t sequence, HandPose& out_handPose)
+    {
+        if (!Update(sequence, nullptr)) {
+            return false;
+        }
+        out_handPose = CachedPose;
+        return true;
+    }
+
+    /// <summary> As GetHandPose(sequence, out_handPose), but calculated with a specific hand geometry. A
+    /// different geometry than last time is a miss. </summary>
+    bool GetHandPose(uint64_t sequence, const Kinematics::BasicHandModel& handGeometry, HandPose& out_handPose)
+    {
+        if (!Update(sequence, &handGeometry)) {
+            return false;
+        }
+        out_handPose = CachedPose;
+        return true;
+    }
+
+    /// <summary> As GetHandPose(sequence, out_handPose), using the sequence number of the attached SensorChannel, or
+    /// the raw sensor data if there is none. </summary>
+    bool GetHandPose(HandPose& out_handPose)
+    {
+        return GetHandPose(Channel.GetLatestSequence(), out_handPose);
+    }
+
+    /// <summary> Retrieve the glove's HandPose as a FlatHandPose. A hit is a plain copy, without allocations.
+    /// </summary>
+    bool GetHandPoseInto(uint64_t sequence, FlatHandPose& out_handPose)
+    {
+        if (!Update(sequence, nullptr)) {
+            out_handPose.bValid = false;
+            return false;
+        }
+        out_handPose = CachedFlatPose;
+        return true;
+    }
+
+    /// <summary> As GetHandPoseInto(sequence, out_handPose), using the sequence number of the attached
+    /// SensorChannel, or the raw sensor data if there is none. </summary>
+    bool GetHandPoseInto(FlatHandPose& out_handPose)
+    {
+        return GetHandPoseInto(Channel.GetLatestSequence(), out_handPose);
+    }
+
+    /// <summary> The last pose that was calculated. Only meaningful after a successful GetHandPose call. </summary>
+    SG_NODISCARD const HandPose& GetCachedHandPose() const
+    {
+        return CachedPose;
+    }
+
+    /// <summary> When the sample behind the cached pose passed each stage of the pipeline. Receive and Publish are
+    /// only set while a SensorChannel is attached. The library parses, normalizes and calculates a pose in a single
+    /// call, so Parse marks the start of that call and Kinematics its end; Normalize is not timestamped. </summary>
+    SG_NODISCARD const Util::PipelineTimestamps& GetTimestamps() const
+    {
+        return CachedFlatPose.Timestamps;
+    }
+
+    /// <summary> Latency histograms of every pose this cache calculated, per stage. May be read from any thread.
+    /// </summary>
+    SG_NODISCARD const Util::PipelineLatencyStats& GetLatencyStats() const
+    {
+        return Latency;
+    }
+
+    /// <summary> Remove all recorded latencies. </summary>
+    void ResetLatencyStats()
+    {
+        Latency.Reset();
+    }
+
+    //--------------------------------------------------------------------------------------
+    // Statistics
+
+    /// <summary> Amount of calls that returned the cached pose. </summary>
+    SG_NODISCARD uint64_t GetHits() const
+    {
+        return Hits.load(std::memory_order_relaxed);
+    }
+
+    /// <summary> Amount of calls that had to run the kinematic pipeline. </summary>
+    SG_NODISCARD uint64_t GetMisses() const
+    {
+        return Misses.load(std::memory_order_relaxed);
+    }
+
+    /// <summary> Fraction of calls [0..1] that returned the cached pose. </summary>
+    SG_NODISCARD float GetHitRate() const
+    {
+        const uint64_t hits = GetHits();
+        const uint64_t total = hits + GetMisses();
+        return total > 0 ? static_cast<float>(hits) / static_cast<float>(total) : 0.0f;
+    }
+
+    /// <summary> Reset the hit and miss counters to 0. </summary>
+    void ResetCounters()
+    {
+        Hits.store(0, std::memory_order_relaxed);
+        Misses.store(0, std::memory_order_relaxed);
+    }
+
+private:
+    /// <summary> Make sure the cached pose belongs to sequence (and handGeometry, if any). Returns true if a valid
+    /// pose is cached afterwards. </summary>
+    bool Update(uint64_t sequence, const Kinematics::BasicHandModel* handGeometry)
+    {
+        if (Glove == nullptr) {
+            return false;
+        }
+        const bool bSameGeometry = handGeometry == nullptr
+                                   ? !bCachedWithGeometry
+                                   : bCachedWithGeometry && CachedGeometry.Equals(*handGeometry);
+        // The sequence number is the fast path; without one, fall back to the raw sensor data.
+        const bool bBySensorData = sequence == 0 && ReadSensorData();
+        const bool bSameSample = sequence != 0
+                                 ? !bCachedBySensorData && sequence == CachedSequence
+                                 : bBySensorData && bCachedBySensorData && LatestSensorData == CachedSensorData;
+        if (bCachedValid && bSameSample && bSameGeometry) {
+            Hits.fetch_add(1, std::memory_order_relaxed);
+            Metrics->Increment(Diagnostics::EDeviceCounter::StaleReads);
+            return true;
+        }
+        Misses.fetch_add(1, std::memory_order_relaxed);
+
+        Util::PipelineTimestamps timestamps;
+        timestamps.Clear();
+        if (Channel.IsOpen() && Channel.TryRead(LatestFrame) && LatestFrame.Sequence == sequence) {
+            LatestFrame.GetTimestamps(timestamps);
+        }
+        timestamps.Stamp(Util::ELatencyStage::Parse);
+        const bool bCalculated = handGeometry == nullptr
+                                 ? Glove->GetHandPose(CachedPose)
+                                 : Glove->GetHandPose(*handGeometry, CachedPose);
+        if (!bCalculated) {
+            Metrics->Increment(Diagnostics::EDeviceCounter::ParseFailures);
+            Invalidate();
+            return false;
+        }
+        if (handGeometry != nullptr && !bSameGeometry) {
+            CachedGeometry = *handGeometry;
+        }
+        bCachedWithGeometry = handGeometry != nullptr;
+        timestamps.Stamp(Util::ELatencyStage::Kinematics);
+        CachedFlatPose.CopyFrom(CachedPose);
+        CachedFlatPose.Timestamps = timestamps;
+        Latency.Record(timestamps);
+        Metrics->Increment(Diagnostics::EDeviceCounter::PacketsParsed);
+        if (timestamps.Has(Util::ELatencyStage::Receive)) {
+            Metrics->Record(Diagnostics::EDeviceHistogram::PoseLatency,
+                            timestamps.GetLatencyNs(Util::ELatencyStage::Receive, Util::ELatencyStage::Kinematics));
+        }
+        Metrics->RecordCalibrationState(Glove->GetCalibrationState());
+        CachedSequence = sequence;
+        bCachedBySensorData = bBySensorData;
+        if (bBySensorData) {
+            CachedSensorData.swap(LatestSensorData);
+        }
+        bCachedValid = true;
+        return true;
+    }
+
+    /// <summary> Read the glove's latest raw sensor data into LatestSensorData. Returns false if there is none.
+    /// </summary>
+    bool ReadSensorData()
+    {
+        return DeviceList::GetSensorDataString(Glove->GetDeviceIndex(), IpcAddressAccess::Get(*Glove),
+                                               LatestSensorData)
+               && !LatestSensorData.empty();
+    }
+};
@@ -0,0 +1,360 @@
+/**
+ * @file
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2026 SenseGlove
+ *
+ * @section DESCRIPTION
+ *
+ * Latency compensation for glove hand poses. Estimates the angular velocity of
+ * every finger joint from the most recent poses of a glove, and extrapolates
+ * the hand angles to the time at which a frame will be displayed, within the
+ * anatomical joint limits.
+ */
+
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include "Anatomy.hpp"
+#include "BasicHandModel.hpp"
+#include "FlatHandPose.hpp"
+#include "GloveKinematics.hpp"
+#include "HandPose.hpp"
+#include "HapticGlove.hpp"
+#include "JointKinematicsBatch.hpp"
+#include "PipelineLatency.hpp"
+#include "Platform.hpp"
+#include "Vect3D.hpp"
+
+namespace SGCore
+{
+    /// <summary> Predicts the hand angles of a single glove at a future point in time. </summary>
+    class HandPosePredictor;
+}// namespace SGCore
+
+/// <summary> Predicts the hand angles of a single glove at a future point in time. </summary>
+/// <remarks> Keep one predictor per glove, and add every pose read from it. The angular velocity of each joint is the
+/// least-squares slope over the last few poses. Predictions start from the newest pose, and are extrapolated by at most
+/// MaxPredictionTime; if no new pose arrives, the prediction fades back to the newest pose over the same time, rather
+/// than drifting on. Predicted angles are clamped with Anatomy::ClampJointAngle. Timestamps are in nanoseconds of
+/// steady_clock, as Util::PipelineTimestamps::NowNanoseconds(). Not thread-safe; does not allocate after
+/// construction, except to create a default hand geometry when none was set. </remarks>
+class SGCore::HandPosePredictor
+{
+public:
+    /// <summary> Maximum amount of poses used to estimate the velocity. </summary>
+    static constexpr uint32_t MaxHistory = 8;
+
+    /// <summary> Settings of the predictor. </summary>
+    struct Settings
+    {
+        /// <summary> Amount of poses used to estimate the velocity (2 .. MaxHistory). More poses are less sensitive
+        /// to sensor noise, but react later to changes in direction. </summary>
+        uint32_t HistorySize = 4;
+
+        /// <summary> Furthest a pose is extrapolated beyond the newest one, in seconds. </summary>
+        float MaxPredictionTime = 0.05f;
+
+        /// <summary> Clamp predicted angles within the anatomical limits of each joint. </summary>
+        bool bClampAngles = true;
+    };
+
+private:
+    /// <summary> A pose, and the time it was received. </summary>
+    struct Sample
+    {
+        uint64_t TimestampNs;
+        FlatHandPose Pose;
+    };
+
+private:
+    Settings Config;
+    Sample History[MaxHistory];
+    uint32_t Newest = 0;
+    uint32_t Count = 0;
+
+    /// <summary> Angular velocity of each joint, in radians per second. </summary>
+    float Velocity[FlatHandPose::MaxFingers][FlatHandPose::MaxJoints][3];
+
+    Kinematics::JointKinematicsBatch::HandGeometry Geometry;
+    bool bHasGeometry = false;
+
+public:
+    HandPosePredictor()
+    {
+        Reset();
+    }
+
+    explicit HandPosePredictor(const Settings& settings)
+        : Config(settings)
+    {
+        Reset();
+    }
+
+    ~HandPosePredictor() = default;
+
+public:
+    //--------------------------------------------------------------------------------------
+    // Accessors
+
+    SG_NODISCARD const Settings& GetSettings() const
+    {
+        return Config;
+    }
+
+    void SetSettings(const Settings& settings)
+    {
+        Config = settings;
+        UpdateVelocity();
+    }
+
+    /// <summary> Hand geometry used to calculate joint positions of predicted FlatHandPoses. Allocates while reading
+    /// the model, so set it once rather than per frame. </summary>
+    void SetHandGeometry(const Kinematics::BasicHandModel& handGeometry)
+    {
+        Geometry = Kinematics::JointKinematicsBatch::HandGeometry::FromModel(handGeometry);
+        bHasGeometry = true;
+    }
+
+    /// <summary> Amount of poses in the history. </summary>
+    SG_NODISCARD uint32_t GetSampleCount() const
+    {
+        return Count;
+    }
+
+    /// <summary> Time the newest pose was received, or 0 if there is none. </summary>
+    SG_NODISCARD uint64_t GetLatestTimestamp() const
+    {
+        return Count > 0 ? History[Newest].TimestampNs : 0;
+    }
+
+    /// <summary> Estimated angular velocity of one movement (x, y, z = 0, 1, 2) of a finger joint, in radians per
+    /// second. </summary>
+    SG_NODISCARD float GetAngularVelocity(uint32_t finger, uint32_t joint, uint32_t movement) const
+    {
+        return finger < FlatHandPose::MaxFingers && joint < FlatHandPose::MaxJoints && movement < 3
+                   ? Velocity[finger][joint][movement]
+                   : 0.0f;
+    }
+
+    //--------------------------------------------------------------------------------------
+    // History
+
+    /// <summary> Forget all poses. </summary>
+    void Reset()
+    {
+        Newest = 0;
+        Count = 0;
+        std::memset(Velocity, 0, sizeof(Velocity));
+    }
+
+    /// <summary> Add a pose received at timestampNs. Returns false, and ignores the pose, if it is invalid, not newer
+    /// than the newest pose, or has the same angles as the newest pose (i.e. no new data has arrived since). </summary>
+    bool AddSample(const FlatHandPose& pose, uint64_t timestampNs)
+    {
+        if (!pose.bValid) {
+            return false;
+        }
+        if (Count > 0) {
+            const Sample& newest = History[Newest];
+            if (timestampNs <= newest.TimestampNs
+                || std::memcmp(pose.HandAngles, newest.Pose.HandAngles, sizeof(pose.HandAngles)) == 0) {
+                return false;
+            }
+            if (pose.bRightHanded != newest.Pose.bRightHanded) {
+                Reset();
+            }
+        }
+        Newest = Count > 0 ? (Newest + 1) % MaxHistory : 0;
+        History[Newest].TimestampNs = timestampNs;
+        History[Newest].Pose = pose;
+        if (Count < MaxHistory) {
+            ++Count;
+        }
+        UpdateVelocity();
+        return true;
+    }
+
+    /// <summary> Add a pose, timestamped when its sample was received if HandPoseCache filled in its Timestamps, or
+    /// at the current time otherwise. </summary>
+    bool AddSample(const FlatHandPose& pose)
+    {
+        const uint64_t origin = pose.Timestamps.GetOriginNs();
+        return AddSample(pose, origin != 0 ? origin : Util::PipelineTimestamps::NowNanoseconds());
+    }
+
+    //--------------------------------------------------------------------------------------
+    // Prediction
+
+    /// <summary> Predict the hand angles at targetTimeNs into out_handPose, starting from the newest pose. Joint
+    /// positions and rotations are copied from the newest pose, and not updated. Returns false if there are no poses.
+    /// </summary>
+    bool PredictAngles(uint64_t targetTimeNs, FlatHandPose& out_handPose) const
+    {
+        if (Count == 0) {
+            return false;
+        }
+        const Sample& newest = History[Newest];
+        out_handPose = newest.Pose;
+        const float dt = GetExtrapolationTime(newest.TimestampNs, targetTimeNs);
+        for (uint32_t f = 0; f < FlatHandPose::MaxFingers; ++f) {
+            for (uint32_t j = 0; j < out_handPose.AngleCount[f]; ++j) {
+                for (uint32_t m = 0; m < 3; ++m) {
+                    float angle = out_handPose.HandAngles[f][j][m] + Velocity[f][j][m] * dt;
+                    if (Config.bClampAngles) {
+                        angle = Kinematics::Anatomy::ClampJointAngle(angle, static_cast<int32_t>(f),
+                                                                     out_handPose.bRightHanded,
+                                                                     static_cast<int32_t>(j),
+                                                                     static_cast<int32_t>(m));
+                    }
+                    out_handPose.HandAngles[f][j][m] = angle;
+                }
+            }
+        }
+        return true;
+    }
+
+    /// <summary> Predict the full hand pose at targetTimeNs into out_handPose: the predicted angles, and the joint
+    /// positions and rotations that follow from them, as HandPose::FromHandAngles would calculate them. Uses the hand
+    /// geometry set by SetHandGeometry, or Kinematics::GetDefaultHandGeometry if none was set for this hand. Returns
+    /// false if there are no poses. </summary>
+    bool Predict(uint64_t targetTimeNs, FlatHandPose& out_handPose)
+    {
+        if (!PredictAngles(targetTimeNs, out_handPose)) {
+            return false;
+        }
+        const bool bUseGeometry = bHasGeometry && Geometry.bRightHanded == out_handPose.bRightHanded;
+        Kinematics::JointKinematicsBatch::ForwardKinematics(
+                bUseGeometry ? Geometry : Kinematics::GetDefaultHandGeometry(out_handPose.bRightHanded), out_handPose,
+                out_handPose);
+        return true;
+    }
+
+    //--------------------------------------------------------------------------------------
+    // Gloves
+
+    /// <summary> Add the latest hand angles of glove, which should be the only glove used with this predictor,
+    /// timestamped at the current time. Returns false if the glove has no hand angles, or if no new data has arrived
+    /// since the last call. </summary>
+    bool AddSample(const HapticGlove& glove)
+    {
+        FlatHandPose latest;
+        return Kinematics::GetFlatHandAngles(glove, latest) && AddSample(latest);
+    }
+
+    /// <summary> Read the latest hand angles of glove, and predict the full hand pose at targetTimeNs into
+    /// out_handPose, as Predict(targetTimeNs, out_handPose). targetTimeNs is in nanoseconds of steady_clock, e.g. the
+    /// time the next frame will be displayed. Returns false if the glove has never returned hand angles. </summary>
+    bool Predict(const HapticGlove& glove, uint64_t targetTimeNs, FlatHandPose& out_handPose)
+    {
+        AddSample(glove);// no new data is not an error; the prediction continues from the newest pose.
+        return Predict(targetTimeNs, out_handPose);
+    }
+
+    /// <summary> As Predict(glove, targetTimeNs, out_handPose), converted into a HandPose. </summary>
+    /// <remarks> Allocates while creating the HandPose. </remarks>
+    bool Predict(const HapticGlove& glove, uint64_t targetTimeNs, HandPose& out_handPose)
+    {
+        FlatHandPose predicted;
+        if (!Predict(glove, targetTimeNs, predicted)) {
+            return false;
+        }
+        out_handPose = predicted.ToHandPose();
+        return true;
+    }
+
+    /// <summary> As Predict(glove, targetTimeNs, out_handPose), with joint positions calculated by the library from
+    /// a specific hand geometry. </summary>
+    /// <remarks> Allocates while creating the HandPose. </remarks>
+    bool Predict(const HapticGlove& glove, const Kinematics::BasicHandModel& handGeometry, uint64_t targetTimeNs,
+                 HandPose& out_handPose)
+    {
+        AddSample(glove);
+        FlatHandPose predicted;
+        if (!PredictAngles(targetTimeNs, predicted)) {
+            return false;
+        }
+        std::vector<std::vector<Kinematics::Vect3D>> angles(FlatHandPose::MaxFingers);
+        for (uint32_t f = 0; f < FlatHandPose::MaxFingers; ++f) {
+            for (uint32_t j = 0; j < predicted.AngleCount[f]; ++j) {
+                angles[f].emplace_back(predicted.HandAngles[f][j][0], predicted.HandAngles[f][j][1],
+                                       predicted.HandAngles[f][j][2]);
+            }
+        }
+        out_handPose = HandPose::FromHandAngles(angles, predicted.bRightHanded, handGeometry);
+        return true;
+    }
+
+private:
+    /// <summary> Time to extrapolate by, in seconds: the time since the newest pose, up to MaxPredictionTime, after
+    /// which it returns to 0 over another MaxPredictionTime. </summary>
+    float GetExtrapolationTime(uint64_t newestNs, uint64_t targetTimeNs) const
+    {
+        if (targetTimeNs <= newestNs || Config.MaxPredictionTime <= 0.0f) {
+            return 0.0f;
+        }
+        const float elapsed = static_cast<float>(static_cast<double>(targetTimeNs - newestNs) * 1e-9);
+        const float max = Config.MaxPredictionTime;
+        if (elapsed <= max) {
+            return elapsed;
+        }
+        return elapsed < 2.0f * max ? 2.0f * max - elapsed : 0.0f;
+    }
+
+    /// <summary> Least-squares slope of every angle over the last HistorySize poses. </summary>
+    void UpdateVelocity()
+    {
+        std::memset(Velocity, 0, sizeof(Velocity));
+        const uint32_t maxHistory = MaxHistory;
+        const uint32_t historySize = Config.HistorySize < 2
+                                         ? 2
+                                         : (Config.HistorySize > maxHistory ? maxHistory : Config.HistorySize);
+        const uint32_t count = Count < historySize ? Count : historySize;
+        if (count < 2) {
+            return;
+        }
+
+        // Times in seconds relative to the newest pose, to keep float precision.
+        const uint64_t newestNs = History[Newest].TimestampNs;
+        float times[MaxHistory];
+        float meanTime = 0.0f;
+        for (uint32_t i = 0; i < count; ++i) {
+            const Sample& sample = History[(Newest + MaxHistory - i) % MaxHistory];
+            times[i] = -static_cast<float>(static_cast<double>(newestNs - sample.TimestampNs) * 1e-9);
+            meanTime += times[i];
+        }
+        meanTime /= static_cast<float>(count);
+        float timeVariance = 0.0f;
+        for (uint32_t i = 0; i < count; ++i) {
+            timeVariance += (times[i] - meanTime) * (times[i] - meanTime);
+        }
+        if (timeVariance <= 0.0f) {
+            return;
+        }
+
+        const FlatHandPose& newest = History[Newest].Pose;
+        for (uint32_t f = 0; f < FlatHandPose::MaxFingers; ++f) {
+            for (uint32_t j = 0; j < newest.AngleCount[f]; ++j) {
+                for (uint32_t m = 0; m < 3; ++m) {
+                    float meanAngle = 0.0f;
+                    for (uint32_t i = 0; i < count; ++i) {
+                        meanAngle += History[(Newest + MaxHistory - i) % MaxHistory].Pose.HandAngles[f][j][m];
+                    }
+                    meanAngle /= static_cast<float>(count);
+                    float covariance = 0.0f;
+                    for (uint32_t i = 0; i < count; ++i) {
+                        const float angle = History[(Newest + MaxHistory - i) % MaxHistory].Pose.HandAngles[f][j][m];
+                        covariance += (times[i] - meanTime) * (angle - meanAngle);
+                    }
+                    Velocity[f][j][m] = covariance / timeVariance;
+                }
+            }
+        }
+    }
+};
+
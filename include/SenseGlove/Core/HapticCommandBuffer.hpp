@@ -0,0 +1,233 @@
+/**
+ * @file
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2026 SenseGlove
+ *
+ * @section DESCRIPTION
+ *
+ * A fixed-capacity buffer that haptic commands are encoded into in place.
+ * Produces the same bytes as Communications::ToSGBytes and the glove-specific
+ * command encoders, without building a new std::string for every frame.
+ */
+
+
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "Platform.hpp"
+
+namespace SGCore
+{
+    namespace Util
+    {
+        /// <summary> Fixed-capacity buffer that haptic commands are encoded into without allocating. </summary>
+        class HapticCommandBuffer;
+    }// namespace Util
+}// namespace SGCore
+
+/// <summary> Fixed-capacity buffer that haptic commands are encoded into without allocating. </summary>
+/// <remarks> The Write* functions replace the contents of the buffer with a complete command, byte-for-byte
+/// identical to the one the matching library function returns. Appending past the capacity is refused and marks the
+/// buffer as overflowed, after which the contents should not be sent. DeviceList::SendHaptics takes a std::string;
+/// use CopyTo with a string that is kept between frames, so that it stops allocating once it has grown to fit.
+/// </remarks>
+class SGCore::Util::HapticCommandBuffer
+{
+public:
+    /// <summary> Maximum amount of bytes in a command. The longest glove command is 13 bytes. </summary>
+    static constexpr std::size_t Capacity = 64;
+
+private:
+    char Bytes[Capacity];
+    std::size_t Length = 0;
+    bool bOverflow = false;
+
+public:
+    HapticCommandBuffer() = default;
+
+    ~HapticCommandBuffer() = default;
+
+public:
+    //--------------------------------------------------------------------------------------
+    // Protocol
+
+    /// <summary> Byte indicating the start of a new command, as Communications::GetCommandOpen. </summary>
+    static constexpr char GetCommandOpen()
+    {
+        return '{';
+    }
+
+    /// <summary> Byte indicating the end of a command, as Communications::GetCommandClose. </summary>
+    static constexpr char GetCommandClose()
+    {
+        return '}';
+    }
+
+    /// <summary> Command identifier for haptic levels, which follows the opening byte. </summary>
+    static constexpr char GetLevelsCommand()
+    {
+        return 'Z';
+    }
+
+    /// <summary> Convert a value between 0..100 to a Sense Glove byte, as Communications::ToSGByte. </summary>
+    static SG_FORCEINLINE char ToSGByte(int32_t level)
+    {
+        return static_cast<char>(level + 1);
+    }
+
+    /// <summary> Convert a value between 0..1 to a Sense Glove byte, as Communications::FloatToSGByte. </summary>
+    static SG_FORCEINLINE char FloatToSGByte(float level01)
+    {
+        return static_cast<char>(static_cast<int32_t>(std::round(level01 * 100.0f)) + 1);
+    }
+
+public:
+    //--------------------------------------------------------------------------------------
+    // Accessors
+
+    /// <summary> The encoded bytes. Not null-terminated. </summary>
+    SG_NODISCARD const char* GetData() const
+    {
+        return Bytes;
+    }
+
+    /// <summary> Amount of encoded bytes. </summary>
+    SG_NODISCARD std::size_t GetSize() const
+    {
+        return Length;
+    }
+
+    /// <summary> Returns true if no bytes are encoded. </summary>
+    SG_NODISCARD bool IsEmpty() const
+    {
+        return Length == 0;
+    }
+
+    /// <summary> Returns true if a write did not fit, in which case the contents are incomplete. </summary>
+    SG_NODISCARD bool HasOverflowed() const
+    {
+        return bOverflow;
+    }
+
+    /// <summary> Returns true if this buffer holds exactly the same bytes as other. </summary>
+    SG_NODISCARD bool Equals(const HapticCommandBuffer& other) const
+    {
+        return Length == other.Length && std::memcmp(Bytes, other.Bytes, Length) == 0;
+    }
+
+    /// <summary> Returns true if this buffer holds exactly the same bytes as command. </summary>
+    SG_NODISCARD bool Equals(const std::string& command) const
+    {
+        return Length == command.size() && std::memcmp(Bytes, command.data(), Length) == 0;
+    }
+
+    /// <summary> Copy the encoded bytes into out_command, re-using its capacity. </summary>
+    void CopyTo(std::string& out_command) const
+    {
+        out_command.assign(Bytes, Length);
+    }
+
+    /// <summary> The encoded bytes as a new string. Allocates if the command is longer than the small string
+    /// buffer; prefer CopyTo in a streaming loop. </summary>
+    SG_NODISCARD std::string ToString() const
+    {
+        return std::string(Bytes, Length);
+    }
+
+    //--------------------------------------------------------------------------------------
+    // Writing
+
+    /// <summary> Remove all bytes and reset the overflow flag. </summary>
+    void Clear()
+    {
+        Length = 0;
+        bOverflow = false;
+    }
+
+    /// <summary> Append a single byte. Returns false if the buffer is full. </summary>
+    bool Append(char byte)
+    {
+        if (Length >= Capacity) {
+            bOverflow = true;
+            return false;
+        }
+        Bytes[Length++] = byte;
+        return true;
+    }
+
+    /// <summary> Append messageLength bytes encoding values01, as Communications::ToSGBytes. If there are fewer
+    /// than messageLength values, the remainder is padded with fallbackValue. </summary>
+    bool AppendSGBytes(const float* values01, std::size_t valueCount, int32_t messageLength,
+                       float fallbackValue = 0.0f)
+    {
+        if (messageLength <= 0) {
+            return true;
+        }
+        const std::size_t count = static_cast<std::size_t>(messageLength);
+        if (Length + count > Capacity) {
+            bOverflow = true;
+            return false;
+        }
+        const char fallbackByte = FloatToSGByte(fallbackValue);
+        for (std::size_t i = 0; i < count; ++i) {
+            Bytes[Length++] = i < valueCount ? FloatToSGByte(values01[i]) : fallbackByte;
+        }
+        return true;
+    }
+
+    /// <summary> As AppendSGBytes(values01, valueCount, messageLength, fallbackValue). </summary>
+    bool AppendSGBytes(const std::vector<float>& values01, int32_t messageLength, float fallbackValue = 0.0f)
+    {
+        return AppendSGBytes(values01.data(), values01.size(), messageLength, fallbackValue);
+    }
+
+    /// <summary> Encode a Nova 1.0 command, as NovaGlove::ToNovaCommand: 4 force-feedback levels, the wrist level
+    /// and 2 vibration levels. </summary>
+    /// <remarks> Like the library, wristLevel is truncated to an integer level before encoding. </remarks>
+    bool WriteNovaCommand(const std::vector<float>& forceFeedbackLevels, const std::vector<float>& buzzLevels,
+                          float wristLevel)
+    {
+        Clear();
+        Append(GetCommandOpen());
+        Append(GetLevelsCommand());
+        AppendSGBytes(forceFeedbackLevels, 4);
+        Append(ToSGByte(static_cast<int32_t>(wristLevel)));
+        AppendSGBytes(buzzLevels, 2);
+        Append(GetCommandClose());
+        return !bOverflow;
+    }
+
+    /// <summary> Encode a Nova 2.0 streaming command, as Nova2Glove::ToStreamCommand: 4 force-feedback levels and
+    /// the wrist squeeze level. </summary>
+    bool WriteNova2StreamCommand(const std::vector<float>& forceFeedbackLevels, float squeezeLevel)
+    {
+        Clear();
+        Append(GetCommandOpen());
+        Append(GetLevelsCommand());
+        AppendSGBytes(forceFeedbackLevels, 4);
+        Append(FloatToSGByte(squeezeLevel));
+        Append(GetCommandClose());
+        return !bOverflow;
+    }
+
+    /// <summary> Encode a SenseGlove DK1 command, as SenseGlove::ToSenseGloveCommand: 5 force-feedback levels and 5
+    /// vibration levels. Thumper commands are sent separately by the library, and are not part of this command.
+    /// </summary>
+    bool WriteSenseGloveCommand(const std::vector<float>& forceFeedbackLevels, const std::vector<float>& buzzLevels)
+    {
+        Clear();
+        Append(GetCommandOpen());
+        Append(GetLevelsCommand());
+        AppendSGBytes(forceFeedbackLevels, 5);
+        AppendSGBytes(buzzLevels, 5);
+        Append(GetCommandClose());
+        return !bOverflow;
+    }
+};
@@ -0,0 +1,354 @@
+/**
+ * @file
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2026 SenseGlove
+ *
+ * @section DESCRIPTION
+ *
+ * Lock-free multi-producer, single-consumer queue of haptic commands for one
+ * glove. Physics, audio and UI threads can enqueue concurrently without a
+ * mutex; the thread that sends the haptics drains the queue and merges the
+ * commands by maximum level, the same way a glove's haptic stream does.
+ */
+
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "HapticGlove.hpp"
+#include "Nova2Glove.hpp"
+#include "Platform.hpp"
+
+namespace SGCore
+{
+    namespace Haptics
+    {
+        /// <summary> Types of commands that can be enqueued in a HapticCommandQueue. </summary>
+        enum class EHapticCommandType : uint8_t
+        {
+            /// <summary> Set the force-feedback level of a finger. </summary>
+            ForceFeedback,
+            /// <summary> Set the vibration level of a finger. </summary>
+            Vibro,
+            /// <summary> Set the wrist squeeze level. </summary>
+            Squeeze,
+            /// <summary> Stop all haptics. Commands enqueued before it are discarded. </summary>
+            StopHaptics
+        };
+
+        /// <summary> A single enqueued haptic command. </summary>
+        struct HapticCommand
+        {
+            EHapticCommandType Type;
+            /// <summary> Finger index (0 = thumb, 4 = pinky) for finger commands. </summary>
+            uint8_t Finger;
+            /// <summary> Level [0...1]. </summary>
+            float Level;
+        };
+
+        /// <summary> Lock-free MPSC queue of haptic commands for one glove, merged by maximum level. </summary>
+        class HapticCommandQueue;
+    }// namespace Haptics
+}// namespace SGCore
+
+/// <summary> Lock-free MPSC queue of haptic commands for one glove, merged by maximum level. </summary>
+/// <remarks> Enqueue functions may be called from any number of threads at the same time; they never block or
+/// allocate, and return false if the queue is full (the command is then dropped and counted). Drain and FlushTo
+/// must only be called from one thread at a time: the consumer, which is usually the thread that sends the haptics.
+/// When several commands for the same finger are drained together, the highest level wins, so a strong collision
+/// from the physics thread is not undone by a weak audio effect that happens to come later. </remarks>
+class SGCore::Haptics::HapticCommandQueue
+{
+public:
+    /// <summary> Amount of fingers per glove, thumb to pinky. </summary>
+    static constexpr std::size_t FingerCount = 5;
+
+    /// <summary> Default amount of commands the queue can hold. </summary>
+    static constexpr uint32_t GetDefaultCapacity()
+    {
+        return 256;
+    }
+
+    /// <summary> The merged result of draining the queue. A level < 0 means no command was drained for it. </summary>
+    struct MergedLevels
+    {
+        float ForceFeedbackLevels[FingerCount];
+        float VibroLevels[FingerCount];
+        float SqueezeLevel;
+        /// <summary> A StopHaptics command was drained. The levels only contain commands enqueued after it. </summary>
+        bool bStop;
+
+        MergedLevels()
+        {
+            Clear();
+        }
+
+        void Clear()
+        {
+            for (std::size_t f = 0; f < FingerCount; ++f) {
+                ForceFeedbackLevels[f] = -1.0f;
+                VibroLevels[f] = -1.0f;
+            }
+            SqueezeLevel = -1.0f;
+            bStop = false;
+        }
+
+        /// <summary> Returns true if anything was drained. </summary>
+        SG_NODISCARD bool HasCommands() const
+        {
+            if (bStop || SqueezeLevel >= 0.0f) {
+                return true;
+            }
+            for (std::size_t f = 0; f < FingerCount; ++f) {
+                if (ForceFeedbackLevels[f] >= 0.0f || VibroLevels[f] >= 0.0f) {
+                    return true;
+                }
+            }
+            return false;
+        }
+    };
+
+private:
+    /// <summary> A slot of the ring. Sequence tells producers and the consumer whose turn it is (Vyukov's bounded
+    /// queue). </summary>
+    struct Cell
+    {
+        std::atomic<uint64_t> Sequence;
+        HapticCommand Command;
+    };
+
+private:
+    std::unique_ptr<Cell[]> Cells;
+    uint64_t Mask;
+
+    // Producer and consumer positions live on separate cache lines. Padding rather than alignas, so that a queue
+    // can be heap-allocated without over-aligned new.
+    char ProducerPadding[64];
+
+    /// <summary> Next position to claim. Shared by all producers. </summary>
+    std::atomic<uint64_t> EnqueuePosition{0};
+    std::atomic<uint64_t> DroppedCommands{0};
+
+    char ConsumerPadding[64 - 2 * sizeof(std::atomic<uint64_t>)];
+
+    /// <summary> Next position to drain. Only touched by the consumer. </summary>
+    uint64_t DequeuePosition = 0;
+
+public:
+    /// <summary> Create a queue. Capacity is rounded up to a power of two. </summary>
+    explicit HapticCommandQueue(uint32_t capacity = GetDefaultCapacity())
+    {
+        uint32_t size = 2;
+        while (size < capacity && size < (1u << 30)) {
+            size <<= 1;
+        }
+        Cells.reset(new Cell[size]);
+        Mask = size - 1;
+        for (uint32_t i = 0; i < size; ++i) {
+            Cells[i].Sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    HapticCommandQueue(const HapticCommandQueue& rhs) = delete;
+
+    ~HapticCommandQueue() = default;
+
+public:
+    HapticCommandQueue& operator=(const HapticCommandQueue& rhs) = delete;
+
+public:
+    //--------------------------------------------------------------------------------------
+    // Producers, any thread
+
+    /// <summary> Enqueue a command. Returns false if the queue is full. </summary>
+    bool Enqueue(const HapticCommand& command)
+    {
+        uint64_t position = EnqueuePosition.load(std::memory_order_relaxed);
+        Cell* cell;
+        while (true) {
+            cell = &Cells[static_cast<std::size_t>(position & Mask)];
+            const uint64_t sequence = cell->Sequence.load(std::memory_order_acquire);
+            const int64_t difference = static_cast<int64_t>(sequence) - static_cast<int64_t>(position);
+            if (difference == 0) {
+                if (EnqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (difference < 0) {
+                DroppedCommands.fetch_add(1, std::memory_order_relaxed);
+                return false;// the consumer has not freed this cell yet; the queue is full.
+            } else {
+                position = EnqueuePosition.load(std::memory_order_relaxed);
+            }
+        }
+        cell->Command = command;
+        cell->Sequence.store(position + 1, std::memory_order_release);
+        return true;
+    }
+
+    /// <summary> Enqueue a force-feedback level [0...1] for a finger (0 = thumb, 4 = pinky). </summary>
+    bool EnqueueForceFeedbackLevel(int32_t finger, float level01)
+    {
+        return EnqueueFingerLevel(EHapticCommandType::ForceFeedback, finger, level01);
+    }
+
+    /// <summary> Enqueue force-feedback levels [0...1], sorted from thumb to pinky. Values < 0 are ignored. Returns
+    /// false if not all of them fit. </summary>
+    bool EnqueueForceFeedbackLevels(const std::vector<float>& levels01)
+    {
+        return EnqueueFingerLevels(EHapticCommandType::ForceFeedback, levels01);
+    }
+
+    /// <summary> Enqueue a vibration level [0...1] for a finger (0 = thumb, 4 = pinky). </summary>
+    bool EnqueueVibroLevel(int32_t finger, float level01)
+    {
+        return EnqueueFingerLevel(EHapticCommandType::Vibro, finger, level01);
+    }
+
+    /// <summary> Enqueue vibration levels [0...1], sorted from thumb to pinky. Values < 0 are ignored. Returns false
+    /// if not all of them fit. </summary>
+    bool EnqueueVibroLevels(const std::vector<float>& levels01)
+    {
+        return EnqueueFingerLevels(EHapticCommandType::Vibro, levels01);
+    }
+
+    /// <summary> Enqueue a wrist squeeze level [0...1]. </summary>
+    bool EnqueueSqueezeLevel(float squeezeLevel01)
+    {
+        return Enqueue(HapticCommand{EHapticCommandType::Squeeze, 0, ClampLevel(squeezeLevel01)});
+    }
+
+    /// <summary> Enqueue a command to stop all haptics. Commands enqueued before it will not be applied. </summary>
+    bool EnqueueStopHaptics()
+    {
+        return Enqueue(HapticCommand{EHapticCommandType::StopHaptics, 0, 0.0f});
+    }
+
+    /// <summary> Amount of commands that were dropped because the queue was full. </summary>
+    SG_NODISCARD uint64_t GetDroppedCommands() const
+    {
+        return DroppedCommands.load(std::memory_order_relaxed);
+    }
+
+    //--------------------------------------------------------------------------------------
+    // Consumer, one thread
+
+    /// <summary> Remove all enqueued commands and merge them into out_levels, which is cleared first. Returns the
+    /// amount of commands drained. </summary>
+    uint32_t Drain(MergedLevels& out_levels)
+    {
+        out_levels.Clear();
+        uint32_t drained = 0;
+        while (true) {
+            Cell& cell = Cells[static_cast<std::size_t>(DequeuePosition & Mask)];
+            const uint64_t sequence = cell.Sequence.load(std::memory_order_acquire);
+            if (sequence != DequeuePosition + 1) {
+                break;// empty, or the producer that claimed this cell is still writing it.
+            }
+            const HapticCommand command = cell.Command;
+            cell.Sequence.store(DequeuePosition + Mask + 1, std::memory_order_release);
+            ++DequeuePosition;
+            ++drained;
+            Merge(command, out_levels);
+        }
+        return drained;
+    }
+
+    /// <summary> Drain the queue and queue the merged levels on glove, using the HapticGlove Queue functions.
+    /// Returns false if the glove refused any of them, e.g. a squeeze on a glove without a squeeze actuator. Does
+    /// not call SendHaptics. </summary>
+    bool FlushTo(HapticGlove& glove)
+    {
+        MergedLevels levels;
+        Drain(levels);
+        return ApplyTo(levels, glove);
+    }
+
+    /// <summary> Queue merged levels on glove. A drained StopHaptics is applied first. </summary>
+    static bool ApplyTo(const MergedLevels& levels, HapticGlove& glove)
+    {
+        if (levels.bStop) {
+            glove.StopHaptics();
+        }
+        bool bAllQueued = true;
+        std::vector<float> fingerLevels(FingerCount, -1.0f);
+        if (CopyLevels(levels.ForceFeedbackLevels, fingerLevels)) {
+            bAllQueued = glove.QueueForceFeedbackLevels(fingerLevels) && bAllQueued;
+        }
+        if (CopyLevels(levels.VibroLevels, fingerLevels)) {
+            bAllQueued = glove.QueueVibroLevels(fingerLevels) && bAllQueued;
+        }
+        if (levels.SqueezeLevel >= 0.0f) {
+            Nova::Nova2Glove* nova2 = dynamic_cast<Nova::Nova2Glove*>(&glove);
+            bAllQueued = nova2 != nullptr && nova2->QueueSqueezeLevel(levels.SqueezeLevel) && bAllQueued;
+        }
+        return bAllQueued;
+    }
+
+private:
+    static SG_FORCEINLINE float ClampLevel(float level01)
+    {
+        return level01 < 0.0f ? 0.0f : (level01 > 1.0f ? 1.0f : level01);
+    }
+
+    bool EnqueueFingerLevel(EHapticCommandType type, int32_t finger, float level01)
+    {
+        if (finger < 0 || static_cast<std::size_t>(finger) >= FingerCount) {
+            return false;
+        }
+        return Enqueue(HapticCommand{type, static_cast<uint8_t>(finger), ClampLevel(level01)});
+    }
+
+    bool EnqueueFingerLevels(EHapticCommandType type, const std::vector<float>& levels01)
+    {
+        bool bAllEnqueued = true;
+        for (std::size_t f = 0; f < levels01.size() && f < FingerCount; ++f) {
+            if (levels01[f] >= 0.0f) {
+                bAllEnqueued = EnqueueFingerLevel(type, static_cast<int32_t>(f), levels01[f]) && bAllEnqueued;
+            }
+        }
+        return bAllEnqueued;
+    }
+
+    static void Merge(const HapticCommand& command, MergedLevels& out_levels)
+    {
+        switch (command.Type) {
+            case EHapticCommandType::ForceFeedback:
+                MergeMax(out_levels.ForceFeedbackLevels[command.Finger], command.Level);
+                break;
+            case EHapticCommandType::Vibro:
+                MergeMax(out_levels.VibroLevels[command.Finger], command.Level);
+                break;
+            case EHapticCommandType::Squeeze:
+                MergeMax(out_levels.SqueezeLevel, command.Level);
+                break;
+            case EHapticCommandType::StopHaptics:
+                out_levels.Clear();
+                out_levels.bStop = true;
+                break;
+        }
+    }
+
+    static SG_FORCEINLINE void MergeMax(float& out_level, float level)
+    {
+        if (level > out_level) {
+            out_level = level;
+        }
+    }
+
+    /// <summary> Copy merged levels into out_levels. Returns true if any of them was set. </summary>
+    static bool CopyLevels(const float (&levels)[FingerCount], std::vector<float>& out_levels)
+    {
+        bool bAny = false;
+        for (std::size_t f = 0; f < FingerCount; ++f) {
+            out_levels[f] = levels[f];
+            bAny = bAny || levels[f] >= 0.0f;
+        }
+        return bAny;
+    }
+};
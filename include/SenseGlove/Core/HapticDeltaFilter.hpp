@@ -0,0 +1,188 @@
+/**
+ * @file
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2026 SenseGlove
+ *
+ * @section DESCRIPTION
+ *
+ * Suppresses streaming haptic commands that are identical to the last one
+ * that was sent, so idle gloves stop using IPC bandwidth and serial / BLE
+ * airtime. A keep-alive interval makes sure the glove still receives its
+ * current levels every now and then.
+ */
+
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+#include "HapticCommandBuffer.hpp"
+#include "Platform.hpp"
+
+namespace SGCore
+{
+    namespace Haptics
+    {
+        /// <summary> Skips streaming haptic commands that did not change since the last one that was sent. </summary>
+        class HapticDeltaFilter;
+    }// namespace Haptics
+}// namespace SGCore
+
+/// <summary> Skips streaming haptic commands that did not change since the last one that was sent. </summary>
+/// <remarks> Opt-in: a new filter lets every command through until SetEnabled(true) is called. Only use it for
+/// streaming channels, where the latest command replaces the previous one; fire-and-forget commands such as custom
+/// waveforms must always be sent. Call Invalidate() when the glove's state may have changed outside of this filter,
+/// e.g. after StopHaptics, so the next command is sent regardless. ShouldSend is not thread-safe; the counters may be
+/// read from any thread. </remarks>
+class SGCore::Haptics::HapticDeltaFilter
+{
+public:
+    using Clock = std::chrono::steady_clock;
+
+private:
+    bool bEnabled = false;
+    Clock::duration KeepAliveInterval = std::chrono::milliseconds(500);
+
+    Util::HapticCommandBuffer LastCommand;
+    Clock::time_point LastSendTime;
+    bool bHasLastCommand = false;
+
+    std::atomic<uint64_t> SentWrites{0};
+    std::atomic<uint64_t> SkippedWrites{0};
+
+public:
+    HapticDeltaFilter() = default;
+
+    /// <summary> Create a filter with suppression enabled or disabled, and a keep-alive interval. </summary>
+    HapticDeltaFilter(bool bEnable, Clock::duration keepAliveInterval)
+        : bEnabled(bEnable), KeepAliveInterval(keepAliveInterval)
+    {
+    }
+
+    HapticDeltaFilter(const HapticDeltaFilter& rhs)
+        : bEnabled(rhs.bEnabled), KeepAliveInterval(rhs.KeepAliveInterval),
+          LastCommand(rhs.LastCommand), LastSendTime(rhs.LastSendTime), bHasLastCommand(rhs.bHasLastCommand),
+          SentWrites(rhs.GetSentWrites()), SkippedWrites(rhs.GetSkippedWrites())
+    {
+    }
+
+    ~HapticDeltaFilter() = default;
+
+public:
+    HapticDeltaFilter& operator=(const HapticDeltaFilter& rhs)
+    {
+        if (this != &rhs) {
+            bEnabled = rhs.bEnabled;
+            KeepAliveInterval = rhs.KeepAliveInterval;
+            LastCommand = rhs.LastCommand;
+            LastSendTime = rhs.LastSendTime;
+            bHasLastCommand = rhs.bHasLastCommand;
+            SentWrites.store(rhs.GetSentWrites(), std::memory_order_relaxed);
+            SkippedWrites.store(rhs.GetSkippedWrites(), std::memory_order_relaxed);
+        }
+        return *this;
+    }
+
+public:
+    //--------------------------------------------------------------------------------------
+    // Settings
+
+    /// <summary> Returns true if identical commands are suppressed. </summary>
+    SG_NODISCARD bool IsEnabled() const
+    {
+        return bEnabled;
+    }
+
+    /// <summary> Enable or disable suppression. Disabling lets every command through again. </summary>
+    void SetEnabled(bool bEnable)
+    {
+        bEnabled = bEnable;
+        Invalidate();
+    }
+
+    /// <summary> The longest time an unchanged command is suppressed before it is sent again. </summary>
+    SG_NODISCARD Clock::duration GetKeepAliveInterval() const
+    {
+        return KeepAliveInterval;
+    }
+
+    /// <summary> Set the keep-alive interval. A zero interval never suppresses anything. </summary>
+    void SetKeepAliveInterval(Clock::duration keepAliveInterval)
+    {
+        KeepAliveInterval = keepAliveInterval;
+    }
+
+    //--------------------------------------------------------------------------------------
+    // Filtering
+
+    /// <summary> Decide whether command should be sent at time now. Returns false if it is identical to the last
+    /// command that was let through, and the keep-alive interval has not elapsed since. A command that is let
+    /// through becomes the new reference. </summary>
+    bool ShouldSend(const Util::HapticCommandBuffer& command, Clock::time_point now)
+    {
+        if (bEnabled && bHasLastCommand && LastCommand.Equals(command) && now - LastSendTime < KeepAliveInterval) {
+            SkippedWrites.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        LastCommand = command;
+        LastSendTime = now;
+        bHasLastCommand = true;
+        SentWrites.fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    /// <summary> As ShouldSend(command, now), using the current time. </summary>
+    bool ShouldSend(const Util::HapticCommandBuffer& command)
+    {
+        return ShouldSend(command, Clock::now());
+    }
+
+    /// <summary> As ShouldSend(command, now), for commands that were already encoded into a string. Commands longer
+    /// than HapticCommandBuffer::Capacity are always sent. </summary>
+    bool ShouldSend(const std::string& command, Clock::time_point now)
+    {
+        Util::HapticCommandBuffer buffer;
+        for (char byte : command) {
+            if (!buffer.Append(byte)) {
+                Invalidate();
+                SentWrites.fetch_add(1, std::memory_order_relaxed);
+                return true;
+            }
+        }
+        return ShouldSend(buffer, now);
+    }
+
+    /// <summary> Forget the last command, so that the next one is sent regardless. Call this when a send failed, or
+    /// when the glove's haptics were changed without going through this filter. </summary>
+    void Invalidate()
+    {
+        bHasLastCommand = false;
+    }
+
+    //--------------------------------------------------------------------------------------
+    // Statistics
+
+    /// <summary> Amount of commands that were let through. </summary>
+    SG_NODISCARD uint64_t GetSentWrites() const
+    {
+        return SentWrites.load(std::memory_order_relaxed);
+    }
+
+    /// <summary> Amount of commands that were suppressed. </summary>
+    SG_NODISCARD uint64_t GetSkippedWrites() const
+    {
+        return SkippedWrites.load(std::memory_order_relaxed);
+    }
+
+    /// <summary> Reset the sent and skipped counters to 0. </summary>
+    void ResetCounters()
+    {
+        SentWrites.store(0, std::memory_order_relaxed);
+        SkippedWrites.store(0, std::memory_order_relaxed);
+    }
+};
@@ -0,0 +1,182 @@
+/**
+ * @file
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2026 SenseGlove
+ *
+ * @section DESCRIPTION
+ *
+ * Describes a haptic effect composed of multiple CustomWaveforms, played at
+ * different locations of the hand with timed offsets and crossfades. Played
+ * by a WaveformSequencer.
+ */
+
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include "CustomWaveform.hpp"
+#include "HapticGlove.hpp"
+#include "Platform.hpp"
+
+namespace SGCore
+{
+    namespace Haptics
+    {
+        /// <summary> A set of CustomWaveforms, each played at a location and an offset from the start. </summary>
+        class HapticTimeline;
+    }// namespace Haptics
+}// namespace SGCore
+
+/// <summary> A set of CustomWaveforms, each played at a location and an offset from the start. </summary>
+/// <remarks> A timeline only describes the effect; it does not touch any glove, and can be played any number of times
+/// on any number of gloves with WaveformSequencer::Play. Crossfades are approximated on the host by a series of short
+/// pulses whose amplitudes ramp between the two waveforms, since the gloves play one waveform per motor at a time.
+/// </remarks>
+class SGCore::Haptics::HapticTimeline
+{
+public:
+    /// <summary> Offsets are stored with microsecond resolution. </summary>
+    using Offset = std::chrono::microseconds;
+
+    /// <summary> A single waveform on the timeline. </summary>
+    struct Pulse
+    {
+        /// <summary> Time from the start of the timeline at which the waveform is sent. </summary>
+        Offset StartOffset;
+
+        /// <summary> Location the waveform is played at. </summary>
+        EHapticLocation Location;
+
+        /// <summary> The waveform to play. </summary>
+        SGCore::CustomWaveform Waveform;
+
+        Pulse(Offset startOffset, EHapticLocation location, const SGCore::CustomWaveform& waveform)
+            : StartOffset(startOffset), Location(location), Waveform(waveform)
+        {
+        }
+    };
+
+    /// <summary> Amount of pulses a crossfade is split into, unless specified otherwise. </summary>
+    static constexpr int32_t DefaultCrossfadeSteps = 8;
+
+    /// <summary> Shortest pulse of a crossfade, in seconds; the gloves do not sustain a waveform for less. </summary>
+    static constexpr float MinCrossfadeStepTime = 0.01f;
+
+private:
+    std::vector<Pulse> Pulses;
+
+public:
+    HapticTimeline() = default;
+
+    ~HapticTimeline() = default;
+
+public:
+    //--------------------------------------------------------------------------------------
+    // Composition
+
+    /// <summary> Play waveform at location, offsetTime seconds after the start of the timeline. </summary>
+    HapticTimeline& Add(float offsetTime, const SGCore::CustomWaveform& waveform, EHapticLocation location)
+    {
+        Pulses.emplace_back(ToOffset(offsetTime), location, waveform);
+        return *this;
+    }
+
+    /// <summary> Fade from one waveform to another over duration seconds, starting offsetTime seconds after the start
+    /// of the timeline. If both locations are the same, each step plays a single waveform whose amplitude and
+    /// frequencies are interpolated. Otherwise, from fades out at fromLocation while to fades in at toLocation.
+    /// </summary>
+    HapticTimeline& AddCrossfade(float offsetTime, float duration,
+                                 const SGCore::CustomWaveform& from, EHapticLocation fromLocation,
+                                 const SGCore::CustomWaveform& to, EHapticLocation toLocation,
+                                 int32_t steps = DefaultCrossfadeSteps)
+    {
+        const int32_t minSteps = 1;
+        const float minStepTime = MinCrossfadeStepTime;
+        steps = std::max(steps, minSteps);
+        const float stepTime = std::max(duration / static_cast<float>(steps), minStepTime);
+        steps = std::max(static_cast<int32_t>(duration / stepTime), minSteps);
+
+        for (int32_t step = 0; step < steps; ++step) {
+            const float t = (static_cast<float>(step) + 0.5f) / static_cast<float>(steps);
+            const float stepOffset = offsetTime + static_cast<float>(step) * stepTime;
+            if (fromLocation == toLocation) {
+                SGCore::CustomWaveform blend = ToStep(t < 0.5f ? from : to, stepTime, 1.0f);
+                blend.SetAmplitude(Lerp(from.GetAmplitude(), to.GetAmplitude(), t));
+                blend.SetFrequencyStart(Lerp(from.GetFrequencyStart(), to.GetFrequencyStart(), t));
+                blend.SetFrequencyEnd(Lerp(from.GetFrequencyEnd(), to.GetFrequencyEnd(), t));
+                Add(stepOffset, blend, fromLocation);
+            } else {
+                Add(stepOffset, ToStep(from, stepTime, 1.0f - t), fromLocation);
+                Add(stepOffset, ToStep(to, stepTime, t), toLocation);
+            }
+        }
+        return *this;
+    }
+
+    /// <summary> Remove all pulses. </summary>
+    void Clear()
+    {
+        Pulses.clear();
+    }
+
+    //--------------------------------------------------------------------------------------
+    // Accessors
+
+    /// <summary> All pulses, in the order they were added. </summary>
+    SG_NODISCARD const std::vector<Pulse>& GetPulses() const
+    {
+        return Pulses;
+    }
+
+    /// <summary> Returns true if there is nothing to play. </summary>
+    SG_NODISCARD bool IsEmpty() const
+    {
+        return Pulses.empty();
+    }
+
+    /// <summary> Time, in seconds, from the start of the timeline until its last waveform has finished. Infinitely
+    /// repeating waveforms only count once. </summary>
+    SG_NODISCARD float GetDuration() const
+    {
+        float duration = 0.0f;
+        for (const Pulse& pulse : Pulses) {
+            const float start = std::chrono::duration<float>(pulse.StartOffset).count();
+            const float effect = pulse.Waveform.IsInfinite() || pulse.Waveform.GetRepeatAmount() <= 0
+                                     ? pulse.Waveform.GetEffectTime()
+                                     : pulse.Waveform.GetTotalEffectTime();
+            duration = std::max(duration, start + effect);
+        }
+        return duration;
+    }
+
+private:
+    static Offset ToOffset(float seconds)
+    {
+        return Offset(static_cast<Offset::rep>(std::round(std::max(seconds, 0.0f) * 1000000.0f)));
+    }
+
+    static float Lerp(float from, float to, float t)
+    {
+        return from + (to - from) * t;
+    }
+
+    /// <summary> A single, non-repeating crossfade step of waveform, lasting stepTime seconds. </summary>
+    static SGCore::CustomWaveform ToStep(const SGCore::CustomWaveform& waveform, float stepTime, float weight)
+    {
+        SGCore::CustomWaveform step(waveform);
+        step.SetAmplitude(waveform.GetAmplitude() * weight);
+        step.SetAttackTime(0.0f);
+        step.SetSustainTime(stepTime);
+        step.SetDecayTime(0.0f);
+        step.SetInfinite(false);
+        step.SetRepeatAmount(1);
+        return step;
+    }
+};
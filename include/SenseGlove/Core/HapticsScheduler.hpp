@@ -0,0 +1,359 @@
+/**
+ * @file
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2026 SenseGlove
+ *
+ * @section DESCRIPTION
+ *
+ * An optional thread that sends haptics to the gloves at a fixed rate, so
+ * that jitter in the application's render loop does not show up as jitter in
+ * the force-feedback. Applications only enqueue levels, without locking; the
+ * scheduler thread flushes them to the gloves every period.
+ */
+
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "HapticCommandQueue.hpp"
+#include "HapticGlove.hpp"
+#include "HapticsTransaction.hpp"
+#include "PeriodicTimer.hpp"
+#include "Platform.hpp"
+#include "PlatformWin32.hpp"
+
+#if !SG_PLATFORM_WINDOWS
+#include <pthread.h>
+#include <sched.h>
+#endif  /* !SG_PLATFORM_WINDOWS */
+
+namespace SGCore
+{
+    /// <summary> Sends enqueued haptic levels to a set of gloves at a fixed rate, from its own thread. </summary>
+    class HapticsScheduler;
+}// namespace SGCore
+
+/// <summary> Sends enqueued haptic levels to a set of gloves at a fixed rate, from its own thread. </summary>
+/// <remarks> The Queue* functions push onto the glove's lock-free HapticCommandQueue, so they can be called from any
+/// number of threads at once, also while the scheduler is running. Every period, the scheduler thread drains the
+/// queues, stages the merged levels in a HapticsTransaction and commits it. When several levels are enqueued for the
+/// same finger within one period, the highest one wins. Gloves must be added before Start(). Custom waveforms are not
+/// scheduled; send those directly. </remarks>
+class SGCore::HapticsScheduler
+{
+public:
+    /// <summary> Amount of fingers per glove, thumb to pinky. </summary>
+    static constexpr std::size_t FingerCount = HapticsTransaction::FingerCount;
+
+    /// <summary> Settings of the scheduler thread. </summary>
+    struct Settings
+    {
+        /// <summary> Haptic updates per second, e.g. 250 or 1000. </summary>
+        uint32_t RateHz = 250;
+
+        /// <summary> Run the scheduler thread with real-time priority: SCHED_FIFO on Linux and Android,
+        /// THREAD_PRIORITY_TIME_CRITICAL on Windows. Usually requires elevated rights; check IsRealTime() after
+        /// Start(). </summary>
+        bool bRealTimePriority = false;
+
+        /// <summary> SCHED_FIFO priority [1..99], used when bRealTimePriority is set. Ignored on Windows. </summary>
+        int32_t RealTimePriority = 80;
+
+        /// <summary> Pin the scheduler thread to this CPU core. -1 lets the operating system decide. </summary>
+        int32_t CpuAffinity = -1;
+
+        /// <summary> Spin instead of sleeping for the last part of each period. Costs a core, but keeps the period
+        /// steady at 1 kHz. </summary>
+        bool bSpinWait = false;
+
+        /// <summary> Skip gloves whose levels did not change, see HapticsTransaction::SetDeltaSuppression.
+        /// </summary>
+        bool bDeltaSuppression = false;
+
+        /// <summary> Keep-alive interval of the delta suppression. </summary>
+        std::chrono::steady_clock::duration KeepAliveInterval = std::chrono::milliseconds(500);
+
+        /// <summary> Amount of commands each glove's queue can hold between two periods. </summary>
+        uint32_t QueueCapacity = Haptics::HapticCommandQueue::GetDefaultCapacity();
+    };
+
+private:
+    Settings Config;
+    HapticsTransaction Transaction;
+    std::vector<std::unique_ptr<Haptics::HapticCommandQueue>> Queues;
+    Haptics::HapticCommandQueue::MergedLevels Drained;
+    std::vector<EHapticsCommitResult> Results;
+
+    std::thread Dispatcher;
+    std::atomic<bool> bRunning{false};
+    std::atomic<bool> bRealTime{false};
+    std::atomic<uint64_t> Ticks{0};
+    std::atomic<uint64_t> Overruns{0};
+    std::atomic<uint64_t> FailedCommits{0};
+
+public:
+    HapticsScheduler() = default;
+
+    explicit HapticsScheduler(const Settings& settings)
+        : Config(settings)
+    {
+    }
+
+    HapticsScheduler(const HapticsScheduler& rhs) = delete;
+
+    ~HapticsScheduler()
+    {
+        Stop();
+    }
+
+public:
+    HapticsScheduler& operator=(const HapticsScheduler& rhs) = delete;
+
+public:
+    //--------------------------------------------------------------------------------------
+    // Gloves
+
+    /// <summary> Add a glove to the scheduler. Returns its index, used by the Queue functions, or -1 while running.
+    /// </summary>
+    int32_t AddGlove(std::shared_ptr<HapticGlove> glove)
+    {
+        if (IsRunning()) {
+            return -1;
+        }
+        Queues.emplace_back(new Haptics::HapticCommandQueue(Config.QueueCapacity));
+        return Transaction.AddGlove(std::move(glove));
+    }
+
+    /// <summary> Amount of gloves in this scheduler. </summary>
+    SG_NODISCARD int32_t GetGloveCount() const
+    {
+        return Transaction.GetGloveCount();
+    }
+
+    /// <summary> Returns the index of the glove for the chosen hand, or -1 if this scheduler has none. </summary>
+    SG_NODISCARD int32_t FindGlove(bool bRightHanded) const
+    {
+        return Transaction.FindGlove(bRightHanded);
+    }
+
+    //--------------------------------------------------------------------------------------
+    // Enqueueing, lock-free
+
+    /// <summary> The command queue of a glove, e.g. to hand to a thread that only produces haptics. nullptr if the
+    /// index is out of range. </summary>
+    SG_NODISCARD Haptics::HapticCommandQueue* GetQueue(int32_t gloveIndex) const
+    {
+        return IsValidIndex(gloveIndex) ? Queues[static_cast<std::size_t>(gloveIndex)].get() : nullptr;
+    }
+
+    /// <summary> Set the force-feedback level [0...1] of a finger (0 = thumb, 4 = pinky) from the next period on.
+    /// </summary>
+    bool QueueForceFeedbackLevel(int32_t gloveIndex, int32_t finger, float level01)
+    {
+        return IsValidIndex(gloveIndex) && GetQueue(gloveIndex)->EnqueueForceFeedbackLevel(finger, level01);
+    }
+
+    /// <summary> Set force-feedback levels [0...1], sorted from thumb to pinky. Values < 0 are ignored. </summary>
+    bool QueueForceFeedbackLevels(int32_t gloveIndex, const std::vector<float>& levels01)
+    {
+        return IsValidIndex(gloveIndex) && GetQueue(gloveIndex)->EnqueueForceFeedbackLevels(levels01);
+    }
+
+    /// <summary> Set the vibration level [0...1] of a finger (0 = thumb, 4 = pinky) from the next period on.
+    /// </summary>
+    bool QueueVibroLevel(int32_t gloveIndex, int32_t finger, float level01)
+    {
+        return IsValidIndex(gloveIndex) && GetQueue(gloveIndex)->EnqueueVibroLevel(finger, level01);
+    }
+
+    /// <summary> Set vibration levels [0...1], sorted from thumb to pinky. Values < 0 are ignored. </summary>
+    bool QueueVibroLevels(int32_t gloveIndex, const std::vector<float>& levels01)
+    {
+        return IsValidIndex(gloveIndex) && GetQueue(gloveIndex)->EnqueueVibroLevels(levels01);
+    }
+
+    /// <summary> Set the wrist squeeze level [0...1] from the next period on. Only for gloves that support it.
+    /// </summary>
+    bool QueueSqueezeLevel(int32_t gloveIndex, float squeezeLevel01)
+    {
+        return IsValidIndex(gloveIndex) && GetQueue(gloveIndex)->EnqueueSqueezeLevel(squeezeLevel01);
+    }
+
+    /// <summary> Stop all haptics on a glove at the next period. Levels enqueued before are discarded. </summary>
+    bool QueueStopHaptics(int32_t gloveIndex)
+    {
+        return IsValidIndex(gloveIndex) && GetQueue(gloveIndex)->EnqueueStopHaptics();
+    }
+
+    //--------------------------------------------------------------------------------------
+    // Dispatching
+
+    /// <summary> Start the scheduler thread. Returns false if already running, or if the rate is 0. </summary>
+    bool Start()
+    {
+        if (IsRunning() || Config.RateHz == 0) {
+            return false;
+        }
+        Transaction.SetDeltaSuppression(Config.bDeltaSuppression, Config.KeepAliveInterval);
+        bRunning.store(true, std::memory_order_release);
+        Dispatcher = std::thread(&HapticsScheduler::Run, this);
+        return true;
+    }
+
+    /// <summary> Stop the scheduler thread. Levels that were enqueued but not yet sent stay enqueued. </summary>
+    void Stop()
+    {
+        if (!bRunning.exchange(false, std::memory_order_acq_rel)) {
+            return;
+        }
+        if (Dispatcher.joinable()) {
+            Dispatcher.join();
+        }
+        bRealTime.store(false, std::memory_order_release);
+    }
+
+    /// <summary> Returns true while the scheduler thread runs. </summary>
+    SG_NODISCARD bool IsRunning() const
+    {
+        return bRunning.load(std::memory_order_acquire);
+    }
+
+    /// <summary> Returns true if the scheduler thread obtained the requested real-time priority. </summary>
+    SG_NODISCARD bool IsRealTime() const
+    {
+        return bRealTime.load(std::memory_order_acquire);
+    }
+
+    /// <summary> Send everything that is enqueued on the calling thread. Useful without a scheduler thread, e.g. in
+    /// deterministic tests. Returns false while running. </summary>
+    bool Flush()
+    {
+        if (IsRunning()) {
+            return false;
+        }
+        Dispatch();
+        return true;
+    }
+
+    /// <summary> Amount of periods the scheduler thread dispatched. </summary>
+    SG_NODISCARD uint64_t GetTicks() const
+    {
+        return Ticks.load(std::memory_order_relaxed);
+    }
+
+    /// <summary> Amount of periods the scheduler fell so far behind that it had to skip ahead. </summary>
+    SG_NODISCARD uint64_t GetOverruns() const
+    {
+        return Overruns.load(std::memory_order_relaxed);
+    }
+
+    /// <summary> Amount of periods in which at least one glove could not be sent to. </summary>
+    SG_NODISCARD uint64_t GetFailedCommits() const
+    {
+        return FailedCommits.load(std::memory_order_relaxed);
+    }
+
+    /// <summary> Amount of commands dropped because a glove's queue was full, over all gloves. </summary>
+    SG_NODISCARD uint64_t GetDroppedCommands() const
+    {
+        uint64_t dropped = 0;
+        for (const std::unique_ptr<Haptics::HapticCommandQueue>& queue : Queues) {
+            dropped += queue->GetDroppedCommands();
+        }
+        return dropped;
+    }
+
+    /// <summary> Amount of glove writes skipped by delta suppression. </summary>
+    SG_NODISCARD uint64_t GetSkippedWrites() const
+    {
+        return Transaction.GetSkippedWrites();
+    }
+
+private:
+    SG_NODISCARD bool IsValidIndex(int32_t gloveIndex) const
+    {
+        return gloveIndex >= 0 && static_cast<std::size_t>(gloveIndex) < Queues.size();
+    }
+
+    /// <summary> Move everything enqueued into the transaction, and commit it. </summary>
+    void Dispatch()
+    {
+        for (std::size_t i = 0; i < Queues.size(); ++i) {
+            if (Queues[i]->Drain(Drained) == 0) {
+                continue;
+            }
+            const int32_t gloveIndex = static_cast<int32_t>(i);
+            if (Drained.bStop) {
+                const std::shared_ptr<HapticGlove> glove = Transaction.GetGlove(gloveIndex);
+                if (glove != nullptr) {
+                    glove->StopHaptics();
+                }
+                Transaction.InvalidateDeltaSuppression();
+            }
+            for (std::size_t f = 0; f < FingerCount; ++f) {
+                const int32_t finger = static_cast<int32_t>(f);
+                if (Drained.ForceFeedbackLevels[f] >= 0.0f) {
+                    Transaction.StageForceFeedbackLevel(gloveIndex, finger, Drained.ForceFeedbackLevels[f]);
+                }
+                if (Drained.VibroLevels[f] >= 0.0f) {
+                    Transaction.StageVibroLevel(gloveIndex, finger, Drained.VibroLevels[f]);
+                }
+            }
+            if (Drained.SqueezeLevel >= 0.0f) {
+                Transaction.StageWristSqueeze(gloveIndex, Drained.SqueezeLevel);
+            }
+        }
+        if (Transaction.HasStagedCommands() && !Transaction.Commit(Results)) {
+            FailedCommits.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    void Run()
+    {
+        bRealTime.store(ApplyThreadSettings(), std::memory_order_release);
+
+        Util::PeriodicTimer timer(Config.RateHz, Config.bSpinWait);
+        while (bRunning.load(std::memory_order_acquire)) {
+            Dispatch();
+            Ticks.fetch_add(1, std::memory_order_relaxed);
+            if (!timer.WaitForNextPeriod()) {
+                Overruns.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /// <summary> Apply priority and affinity to the calling (scheduler) thread. Returns true if real-time priority
+    /// was requested and obtained. Failures are not fatal; the thread then runs with normal priority. </summary>
+    bool ApplyThreadSettings() const
+    {
+#if SG_PLATFORM_WINDOWS
+        if (Config.CpuAffinity >= 0 && Config.CpuAffinity < 64) {
+            ::SetThreadAffinityMask(::GetCurrentThread(), static_cast<Util::Win32::ULongPtr>(1) << Config.CpuAffinity);
+        }
+        return Config.bRealTimePriority
+               && ::SetThreadPriority(::GetCurrentThread(), Util::Win32::ThreadPriorityTimeCritical) != 0;
+#else   /* SG_PLATFORM_WINDOWS */
+        if (Config.CpuAffinity >= 0 && Config.CpuAffinity < CPU_SETSIZE) {
+            cpu_set_t cpus;
+            CPU_ZERO(&cpus);
+            CPU_SET(Config.CpuAffinity, &cpus);
+            sched_setaffinity(0, sizeof(cpus), &cpus);// 0: the calling thread.
+        }
+        if (!Config.bRealTimePriority) {
+            return false;
+        }
+        sched_param parameters{};
+        parameters.sched_priority = Config.RealTimePriority;
+        return pthread_setschedparam(pthread_self(), SCHED_FIFO, &parameters) == 0;
+#endif  /* SG_PLATFORM_WINDOWS */
+    }
+};
@@ -0,0 +1,495 @@
+/**
+ * @file
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2026 SenseGlove
+ *
+ * @section DESCRIPTION
+ *
+ * Stages haptic commands for several gloves at once, and commits all of them
+ * in a single pass. Meant for multi-user setups, where calling
+ * HandLayer::QueueCommand_* and HandLayer::SendHaptics per hand means many
+ * separate round trips every frame.
+ */
+
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "CustomWaveform.hpp"
+#include "DeviceList.hpp"
+#include "HapticCommandBuffer.hpp"
+#include "HapticDeltaFilter.hpp"
+#include "HapticGlove.hpp"
+#include "MetricsRegistry.hpp"
+#include "Nova2Glove.hpp"
+#include "Platform.hpp"
+#include "Tracer.hpp"
+
+namespace SGCore
+{
+    /// <summary> Outcome of committing a HapticsTransaction for a single glove. </summary>
+    enum class EHapticsCommitResult : uint8_t
+    {
+        /// <summary> Nothing was staged for this glove, so nothing was sent. </summary>
+        NothingStaged,
+        /// <summary> All staged commands were queued and sent. </summary>
+        Sent,
+        /// <summary> The glove is no longer connected. Its staged commands were discarded. </summary>
+        Disconnected,
+        /// <summary> One or more staged commands are not supported by this glove, e.g. a wrist squeeze on a Nova 1.0.
+        /// The supported ones were still sent. </summary>
+        PartiallySent,
+        /// <summary> The glove could not send its commands to SenseCom. </summary>
+        Failed,
+        /// <summary> Delta suppression is enabled, and the staged levels did not change since the last commit. Nothing
+        /// was sent. </summary>
+        Suppressed
+    };
+
+    /// <summary> Stages haptic commands for multiple gloves, and commits them all at once. </summary>
+    class HapticsTransaction;
+}// namespace SGCore
+
+/// <summary> Stages haptic commands for multiple gloves, and commits them all at once. </summary>
+/// <remarks> Staging does not touch the gloves; the last value staged for a finger or location wins. Commit() then
+/// takes a single lock, shared by all transactions, queues everything for every glove, and sends each glove's
+/// compiled command once. After a commit, the transaction is empty again and can be re-used for the next frame
+/// without allocating. A transaction itself is not thread-safe: stage and commit from one thread, or use one
+/// transaction per thread. With SetDeltaSuppression, a glove whose force-feedback, vibration and squeeze levels are
+/// the same as at its last commit is skipped until the keep-alive interval elapses. </remarks>
+class SGCore::HapticsTransaction
+{
+public:
+    /// <summary> Amount of fingers that can be staged per glove, thumb to pinky. </summary>
+    static constexpr std::size_t FingerCount = 5;
+
+private:
+    struct StagedCommands
+    {
+        std::shared_ptr<HapticGlove> Glove;
+
+        /// <summary> -1 for fingers that are not staged; HapticGlove::Queue*Levels ignores those. Staging a level
+        /// below 0 leaves the finger as it was. </summary>
+        std::vector<float> ForceFeedbackLevels;
+        std::vector<float> VibroLevels;
+        std::vector<std::pair<EHapticLocation, float>> LocationVibroLevels;
+        float SqueezeLevel = -1.0f;
+        std::vector<std::pair<CustomWaveform, EHapticLocation>> Waveforms;
+
+        bool bStaged = false;
+
+        /// <summary> Levels as of the last commit. Fingers that are not staged keep these levels. </summary>
+        std::vector<float> LastForceFeedbackLevels;
+        std::vector<float> LastVibroLevels;
+        float LastSqueezeLevel = 0.0f;
+        Haptics::HapticDeltaFilter DeltaFilter;
+
+        /// <summary> Metrics of the glove, looked up once. nullptr if there is no glove. </summary>
+        Diagnostics::DeviceMetrics* Metrics = nullptr;
+
+        StagedCommands(std::shared_ptr<HapticGlove> glove, const Haptics::HapticDeltaFilter& deltaFilter)
+            : Glove(std::move(glove)),
+              ForceFeedbackLevels(FingerCount, -1.0f),
+              VibroLevels(FingerCount, -1.0f),
+              LastForceFeedbackLevels(FingerCount, 0.0f),
+              LastVibroLevels(FingerCount, 0.0f),
+              DeltaFilter(deltaFilter)
+        {
+            if (Glove != nullptr) {
+                Metrics = &Diagnostics::MetricsRegistry::ForDevice(Glove->GetDeviceIndex());
+            }
+        }
+
+        void Clear()
+        {
+            std::fill(ForceFeedbackLevels.begin(), ForceFeedbackLevels.end(), -1.0f);
+            std::fill(VibroLevels.begin(), VibroLevels.end(), -1.0f);
+            LocationVibroLevels.clear();
+            SqueezeLevel = -1.0f;
+            Waveforms.clear();
+            bStaged = false;
+        }
+    };
+
+private:
+    std::vector<StagedCommands> Staged;
+
+    /// <summary> Delta suppression settings, copied to gloves that are added later. </summary>
+    Haptics::HapticDeltaFilter DeltaFilterSettings;
+
+public:
+    HapticsTransaction() = default;
+
+    /// <summary> Create a transaction for a list of gloves. Gloves are addressed by their index in this list.
+    /// </summary>
+    explicit HapticsTransaction(const std::vector<std::shared_ptr<HapticGlove>>& gloves)
+    {
+        Staged.reserve(gloves.size());
+        for (const std::shared_ptr<HapticGlove>& glove : gloves) {
+            AddGlove(glove);
+        }
+    }
+
+    ~HapticsTransaction() = default;
+
+public:
+    /// <summary> Create a transaction for all HapticGloves currently connected to SenseCom. </summary>
+    SG_NODISCARD static HapticsTransaction ForConnectedGloves()
+    {
+        HapticsTransaction transaction;
+        for (const std::shared_ptr<SGDevice>& device : DeviceList::GetDevices()) {
+            std::shared_ptr<HapticGlove> glove = std::dynamic_pointer_cast<HapticGlove>(device);
+            if (glove != nullptr && glove->IsConnected()) {
+                transaction.AddGlove(glove);
+            }
+        }
+        return transaction;
+    }
+
+public:
+    //--------------------------------------------------------------------------------------
+    // Gloves
+
+    /// <summary> Add a glove to this transaction. Returns its index, used by the Stage methods. </summary>
+    int32_t AddGlove(std::shared_ptr<HapticGlove> glove)
+    {
+        Staged.emplace_back(std::move(glove), DeltaFilterSettings);
+        return static_cast<int32_t>(Staged.size()) - 1;
+    }
+
+    /// <summary> Amount of gloves in this transaction. </summary>
+    SG_NODISCARD int32_t GetGloveCount() const
+    {
+        return static_cast<int32_t>(Staged.size());
+    }
+
+    /// <summary> The glove at gloveIndex. nullptr if the index is out of range. </summary>
+    SG_NODISCARD std::shared_ptr<HapticGlove> GetGlove(int32_t gloveIndex) const
+    {
+        return IsValidIndex(gloveIndex) ? Staged[static_cast<std::size_t>(gloveIndex)].Glove : nullptr;
+    }
+
+    /// <summary> Returns the index of the glove for the chosen hand, or -1 if this transaction has none. </summary>
+    SG_NODISCARD int32_t FindGlove(bool bRightHanded) const
+    {
+        for (std::size_t i = 0; i < Staged.size(); ++i) {
+            if (Staged[i].Glove != nullptr && Staged[i].Glove->IsRight() == bRightHanded) {
+                return static_cast<int32_t>(i);
+            }
+        }
+        return -1;
+    }
+
+    //--------------------------------------------------------------------------------------
+    // Staging
+
+    /// <summary> Stage a force-feedback level [0...1] for a finger (0 = thumb, 4 = pinky). Values < 0 are ignored.
+    /// </summary>
+    bool StageForceFeedbackLevel(int32_t gloveIndex, int32_t finger, float level01)
+    {
+        return StageFingerLevel(gloveIndex, finger, level01, &StagedCommands::ForceFeedbackLevels);
+    }
+
+    /// <summary> Stage force-feedback levels [0...1], sorted from thumb to pinky. Values < 0 are ignored. </summary>
+    bool StageForceFeedbackLevels(int32_t gloveIndex, const std::vector<float>& levels01)
+    {
+        return StageFingerLevels(gloveIndex, levels01, &StagedCommands::ForceFeedbackLevels);
+    }
+
+    /// <summary> Stage a vibration level [0...1] for a finger (0 = thumb, 4 = pinky). Values < 0 are ignored.
+    /// </summary>
+    bool StageVibroLevel(int32_t gloveIndex, int32_t finger, float level01)
+    {
+        return StageFingerLevel(gloveIndex, finger, level01, &StagedCommands::VibroLevels);
+    }
+
+    /// <summary> Stage vibration levels [0...1], sorted from thumb to pinky. Values < 0 are ignored. </summary>
+    bool StageVibroLevels(int32_t gloveIndex, const std::vector<float>& levels01)
+    {
+        return StageFingerLevels(gloveIndex, levels01, &StagedCommands::VibroLevels);
+    }
+
+    /// <summary> Stage a (continuous) vibration level [0...1] at a specific location. </summary>
+    bool StageVibroLevel(int32_t gloveIndex, EHapticLocation location, float level01)
+    {
+        if (!IsValidIndex(gloveIndex) || location == EHapticLocation::Unknown) {
+            return false;
+        }
+        StagedCommands& staged = Staged[static_cast<std::size_t>(gloveIndex)];
+        for (std::pair<EHapticLocation, float>& locationLevel : staged.LocationVibroLevels) {
+            if (locationLevel.first == location) {
+                locationLevel.second = level01;
+                return true;
+            }
+        }
+        staged.LocationVibroLevels.emplace_back(location, level01);
+        staged.bStaged = true;
+        return true;
+    }
+
+    /// <summary> Stage a wrist squeeze level [0...1]. Only gloves with a squeeze actuator (Nova 2.0) support this;
+    /// for other gloves the commit reports PartiallySent. </summary>
+    bool StageWristSqueeze(int32_t gloveIndex, float squeezeLevel01)
+    {
+        if (!IsValidIndex(gloveIndex)) {
+            return false;
+        }
+        StagedCommands& staged = Staged[static_cast<std::size_t>(gloveIndex)];
+        staged.SqueezeLevel = squeezeLevel01 < 0.0f ? 0.0f : squeezeLevel01;
+        staged.bStaged = true;
+        return true;
+    }
+
+    /// <summary> Stage a custom waveform at a specific location. Waveforms are sent in the order they were staged.
+    /// </summary>
+    bool StageCustomWaveform(int32_t gloveIndex, const CustomWaveform& waveform, EHapticLocation location)
+    {
+        if (!IsValidIndex(gloveIndex)) {
+            return false;
+        }
+        StagedCommands& staged = Staged[static_cast<std::size_t>(gloveIndex)];
+        staged.Waveforms.emplace_back(waveform, location);
+        staged.bStaged = true;
+        return true;
+    }
+
+    /// <summary> Returns true if anything was staged for any glove since the last commit. </summary>
+    SG_NODISCARD bool HasStagedCommands() const
+    {
+        for (const StagedCommands& staged : Staged) {
+            if (staged.bStaged) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /// <summary> Discard everything that was staged, without sending it. </summary>
+    void Clear()
+    {
+        for (StagedCommands& staged : Staged) {
+            staged.Clear();
+        }
+    }
+
+    //--------------------------------------------------------------------------------------
+    // Delta Suppression
+
+    /// <summary> Opt in to skipping gloves whose force-feedback, vibration and squeeze levels did not change since
+    /// their last commit. An unchanged glove is still sent to once every keepAliveInterval. Custom waveforms and
+    /// location-specific vibrations always cause a send. </summary>
+    void SetDeltaSuppression(bool bEnable,
+                             std::chrono::steady_clock::duration keepAliveInterval = std::chrono::milliseconds(500))
+    {
+        DeltaFilterSettings.SetEnabled(bEnable);
+        DeltaFilterSettings.SetKeepAliveInterval(keepAliveInterval);
+        for (StagedCommands& staged : Staged) {
+            staged.DeltaFilter.SetEnabled(bEnable);
+            staged.DeltaFilter.SetKeepAliveInterval(keepAliveInterval);
+        }
+    }
+
+    /// <summary> Returns true if delta suppression is enabled. </summary>
+    SG_NODISCARD bool IsDeltaSuppressionEnabled() const
+    {
+        return DeltaFilterSettings.IsEnabled();
+    }
+
+    /// <summary> Make sure the next commit sends to every glove that has something staged, e.g. after calling
+    /// StopHaptics on a glove outside of this transaction. </summary>
+    void InvalidateDeltaSuppression()
+    {
+        for (StagedCommands& staged : Staged) {
+            staged.DeltaFilter.Invalidate();
+        }
+    }
+
+    /// <summary> Amount of glove writes that were skipped by delta suppression, over all gloves. </summary>
+    SG_NODISCARD uint64_t GetSkippedWrites() const
+    {
+        uint64_t skipped = 0;
+        for (const StagedCommands& staged : Staged) {
+            skipped += staged.DeltaFilter.GetSkippedWrites();
+        }
+        return skipped;
+    }
+
+    /// <summary> Amount of writes to the glove at gloveIndex that were skipped by delta suppression. </summary>
+    SG_NODISCARD uint64_t GetSkippedWrites(int32_t gloveIndex) const
+    {
+        return IsValidIndex(gloveIndex) ? Staged[static_cast<std::size_t>(gloveIndex)].DeltaFilter.GetSkippedWrites()
+                                        : 0;
+    }
+
+    //--------------------------------------------------------------------------------------
+    // Committing
+
+    /// <summary> Send everything that was staged to all gloves, under a single lock. out_results receives one
+    /// result per glove, in the same order as the gloves of this transaction. Returns true if every glove that
+    /// had something staged was sent to successfully. </summary>
+    bool Commit(std::vector<EHapticsCommitResult>& out_results)
+    {
+        out_results.resize(Staged.size());
+        bool bAllSent = true;
+        {
+            SG_TRACE_SCOPE(Diagnostics::EDebugLevel::Haptics_Sent, "HapticsTransaction::Commit");
+            std::lock_guard<std::mutex> lock(GetCommitMutex());
+            const std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+            for (std::size_t i = 0; i < Staged.size(); ++i) {
+                out_results[i] = CommitGlove(Staged[i], now);
+                bAllSent = bAllSent && (out_results[i] == EHapticsCommitResult::Sent
+                                        || out_results[i] == EHapticsCommitResult::NothingStaged
+                                        || out_results[i] == EHapticsCommitResult::Suppressed);
+            }
+        }
+        Clear();
+        return bAllSent;
+    }
+
+    /// <summary> As Commit(out_results), for when the per-glove results are not needed. </summary>
+    bool Commit()
+    {
+        std::vector<EHapticsCommitResult> results;
+        return Commit(results);
+    }
+
+private:
+    SG_NODISCARD bool IsValidIndex(int32_t gloveIndex) const
+    {
+        return gloveIndex >= 0 && static_cast<std::size_t>(gloveIndex) < Staged.size();
+    }
+
+    bool StageFingerLevel(int32_t gloveIndex, int32_t finger, float level01,
+                          std::vector<float> StagedCommands::* levels)
+    {
+        if (!IsValidIndex(gloveIndex) || finger < 0 || static_cast<std::size_t>(finger) >= FingerCount) {
+            return false;
+        }
+        if (level01 >= 0.0f) {
+            StagedCommands& staged = Staged[static_cast<std::size_t>(gloveIndex)];
+            (staged.*levels)[static_cast<std::size_t>(finger)] = level01;
+            staged.bStaged = true;
+        }
+        return true;
+    }
+
+    bool StageFingerLevels(int32_t gloveIndex, const std::vector<float>& levels01,
+                           std::vector<float> StagedCommands::* levels)
+    {
+        if (!IsValidIndex(gloveIndex)) {
+            return false;
+        }
+        StagedCommands& staged = Staged[static_cast<std::size_t>(gloveIndex)];
+        const std::size_t fingerCount = FingerCount;
+        const std::size_t count = levels01.size() < fingerCount ? levels01.size() : fingerCount;
+        for (std::size_t f = 0; f < count; ++f) {
+            if (levels01[f] >= 0.0f) {
+                (staged.*levels)[f] = levels01[f];
+                staged.bStaged = true;
+            }
+        }
+        return true;
+    }
+
+    /// <summary> Queue and send everything staged for a single glove. Called with the commit lock held. </summary>
+    static EHapticsCommitResult CommitGlove(StagedCommands& staged, std::chrono::steady_clock::time_point now)
+    {
+        if (!staged.bStaged) {
+            return EHapticsCommitResult::NothingStaged;
+        }
+        if (staged.Glove == nullptr || !staged.Glove->IsConnected()) {
+            staged.DeltaFilter.Invalidate();
+            return EHapticsCommitResult::Disconnected;
+        }
+        HapticGlove& glove = *staged.Glove;
+
+        // Levels are encoded the way they are sent, so only changes the glove would notice count as a change.
+        MergeLevels(staged.ForceFeedbackLevels, staged.LastForceFeedbackLevels);
+        MergeLevels(staged.VibroLevels, staged.LastVibroLevels);
+        if (staged.SqueezeLevel >= 0.0f) {
+            staged.LastSqueezeLevel = staged.SqueezeLevel;
+        }
+        if (staged.DeltaFilter.IsEnabled()) {
+            Util::HapticCommandBuffer levels;
+            levels.AppendSGBytes(staged.LastForceFeedbackLevels, static_cast<int32_t>(FingerCount));
+            levels.AppendSGBytes(staged.LastVibroLevels, static_cast<int32_t>(FingerCount));
+            levels.Append(Util::HapticCommandBuffer::FloatToSGByte(staged.LastSqueezeLevel));
+            if (!staged.LocationVibroLevels.empty() || !staged.Waveforms.empty()) {
+                staged.DeltaFilter.Invalidate();
+            }
+            if (!staged.DeltaFilter.ShouldSend(levels, now)) {
+                staged.Metrics->Increment(Diagnostics::EDeviceCounter::SuppressedWrites);
+                return EHapticsCommitResult::Suppressed;
+            }
+        }
+
+        bool bAllQueued = true;
+        if (HasLevels(staged.ForceFeedbackLevels)) {
+            bAllQueued = glove.QueueForceFeedbackLevels(staged.ForceFeedbackLevels) && bAllQueued;
+        }
+        if (HasLevels(staged.VibroLevels)) {
+            bAllQueued = glove.QueueVibroLevels(staged.VibroLevels) && bAllQueued;
+        }
+        for (const std::pair<EHapticLocation, float>& locationLevel : staged.LocationVibroLevels) {
+            bAllQueued = glove.QueueVibroLevel(locationLevel.first, locationLevel.second) && bAllQueued;
+        }
+        if (staged.SqueezeLevel >= 0.0f) {
+            Nova::Nova2Glove* nova2 = dynamic_cast<Nova::Nova2Glove*>(&glove);
+            bAllQueued = nova2 != nullptr && nova2->QueueSqueezeLevel(staged.SqueezeLevel) && bAllQueued;
+        }
+
+        // Waveforms are sent directly by the glove; queued levels are compiled into a single command.
+        for (std::pair<CustomWaveform, EHapticLocation>& waveform : staged.Waveforms) {
+            bAllQueued = glove.SendCustomWaveform(waveform.first, waveform.second) && bAllQueued;
+        }
+        const uint64_t sendStartNs = Util::PipelineTimestamps::NowNanoseconds();
+        const bool bSent = glove.SendHaptics();
+        staged.Metrics->Record(Diagnostics::EDeviceHistogram::HapticSendDuration,
+                               Util::PipelineTimestamps::NowNanoseconds() - sendStartNs);
+        if (!bSent) {
+            SG_TRACE(Diagnostics::EDebugLevel::ErrorsOnly, "Failed to send haptics to device {}",
+                     glove.GetDeviceIndex());
+            staged.Metrics->Increment(Diagnostics::EDeviceCounter::IpcWriteFailures);
+            staged.DeltaFilter.Invalidate();
+            return EHapticsCommitResult::Failed;
+        }
+        staged.Metrics->Increment(Diagnostics::EDeviceCounter::HapticWrites);
+        return bAllQueued ? EHapticsCommitResult::Sent : EHapticsCommitResult::PartiallySent;
+    }
+
+    /// <summary> Copy the staged levels (those >= 0) over the last committed ones. </summary>
+    static void MergeLevels(const std::vector<float>& stagedLevels, std::vector<float>& out_lastLevels)
+    {
+        for (std::size_t f = 0; f < stagedLevels.size() && f < out_lastLevels.size(); ++f) {
+            if (stagedLevels[f] >= 0.0f) {
+                out_lastLevels[f] = stagedLevels[f];
+            }
+        }
+    }
+
+    static bool HasLevels(const std::vector<float>& levels)
+    {
+        for (float level : levels) {
+            if (level >= 0.0f) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /// <summary> Shared by all transactions, so that commits from different threads do not interleave. </summary>
+    static std::mutex& GetCommitMutex()
+    {
+        static std::mutex commitMutex;
+        return commitMutex;
+    }
+};
@@ -0,0 +1,508 @@
+/**
+ * @file
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2026 SenseGlove
+ *
+ * @section DESCRIPTION
+ *
+ * Batched forward kinematics. Solves many joint chains at once (all fingers of
+ * a hand, or many hands) from a structure-of-arrays layout, using SSE, AVX2 or
+ * NEON where available and a scalar fallback elsewhere. Follows the same
+ * conventions as JointKinematics::ForwardKinematics.
+ */
+
+
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+#include "BasicHandModel.hpp"
+#include "FlatHandPose.hpp"
+#include "Fingers.hpp"
+#include "Platform.hpp"
+#include "Quat.hpp"
+#include "Vect3D.hpp"
+
+#if !defined ( SG_FK_DISABLE_SIMD )
+#if defined ( __AVX2__ )
+#include <immintrin.h>
+#define SG_FK_SIMD_AVX2 1
+#else   /* defined ( __AVX2__ ) */
+#define SG_FK_SIMD_AVX2 0
+#endif  /* defined ( __AVX2__ ) */
+#if defined ( __SSE2__ ) || defined ( _M_X64 ) || ( defined ( _M_IX86_FP ) && _M_IX86_FP >= 2 )
+#include <emmintrin.h>
+#define SG_FK_SIMD_SSE 1
+#else   /* defined ( __SSE2__ ) || ... */
+#define SG_FK_SIMD_SSE 0
+#endif  /* defined ( __SSE2__ ) || ... */
+#if defined ( __aarch64__ ) || defined ( _M_ARM64 )
+#include <arm_neon.h>
+#define SG_FK_SIMD_NEON 1
+#else   /* defined ( __aarch64__ ) || defined ( _M_ARM64 ) */
+#define SG_FK_SIMD_NEON 0
+#endif  /* defined ( __aarch64__ ) || defined ( _M_ARM64 ) */
+#else   /* !defined ( SG_FK_DISABLE_SIMD ) */
+#define SG_FK_SIMD_AVX2 0
+#define SG_FK_SIMD_SSE 0
+#define SG_FK_SIMD_NEON 0
+#endif  /* !defined ( SG_FK_DISABLE_SIMD ) */
+
+namespace SGCore
+{
+    namespace Kinematics
+    {
+        /// <summary> Batched, SIMD forward kinematics for many joint chains at once. </summary>
+        class JointKinematicsBatch;
+    }// namespace Kinematics
+}// namespace SGCore
+
+/// <summary> Batched, SIMD forward kinematics for many joint chains at once. </summary>
+/// <remarks> Each chain follows JointKinematics::ForwardKinematics: the first joint sits at the start position,
+/// each joint's rotation is the previous rotation multiplied by Quat::FromEuler of its angles, and each next joint is
+/// placed at the previous joint plus the previous rotation applied to the length in between. Results match the
+/// per-finger function within float tolerance (sin/cos are evaluated with a polynomial rather than the C library).
+/// With a HandGeometry from FromModel, hand poses match HandPose::FromHandAngles within the same tolerance.
+/// </remarks>
+class SGCore::Kinematics::JointKinematicsBatch
+{
+public:
+    /// <summary> Input for ChainCount chains of JointCount joints each, in structure-of-arrays layout. </summary>
+    /// <remarks> Start arrays hold ChainCount values. Per-joint arrays are joint-major: the value of joint j of
+    /// chain c lives at [j * ChainCount + c]. Lengths hold (JointCount - 1) entries per chain; the length at j is
+    /// the offset between joint j and joint j + 1. Angles are in radians. </remarks>
+    struct ChainInput
+    {
+        uint32_t ChainCount;
+        uint32_t JointCount;
+
+        const float* StartPositionX;
+        const float* StartPositionY;
+        const float* StartPositionZ;
+
+        const float* StartRotationX;
+        const float* StartRotationY;
+        const float* StartRotationZ;
+        const float* StartRotationW;
+
+        const float* LengthX;
+        const float* LengthY;
+        const float* LengthZ;
+
+        const float* AngleX;
+        const float* AngleY;
+        const float* AngleZ;
+    };
+
+    /// <summary> Output of ChainCount chains of JointCount joints each, joint-major like ChainInput. </summary>
+    struct ChainOutput
+    {
+        float* PositionX;
+        float* PositionY;
+        float* PositionZ;
+
+        float* RotationX;
+        float* RotationY;
+        float* RotationZ;
+        float* RotationW;
+    };
+
+    /// <summary> Flat copy of the parts of a BasicHandModel used by forward kinematics. Create it once per hand
+    /// profile through FromModel; it can then be re-used for every frame without allocations. </summary>
+    struct HandGeometry
+    {
+        bool bRightHanded;
+
+        /// <summary> Amount of joints (including the fingertip) per finger. </summary>
+        uint8_t JointCount[FlatHandPose::MaxFingers];
+
+        float StartPositions[FlatHandPose::MaxFingers][3];
+
+        float StartRotations[FlatHandPose::MaxFingers][4];
+
+        /// <summary> 3D offset between joint j and joint j + 1, in mm. </summary>
+        float Lengths[FlatHandPose::MaxFingers][FlatHandPose::MaxJoints][3];
+
+        /// <summary> Rotation HandPose::FromHandAngles applies to the whole thumb, on top of its start rotation:
+        /// -90 degrees around the x-axis for a right hand, +90 degrees for a left hand. </summary>
+        static Quat GetThumbStartCorrection(bool bRightHanded)
+        {
+            const float halfSqrt2 = std::sqrt(0.5f);
+            return Quat(bRightHanded ? -halfSqrt2 : halfSqrt2, 0.0f, 0.0f, halfSqrt2);
+        }
+
+        /// <summary> Copy the start positions, rotations and 3D lengths of a hand model. The thumb's start rotation
+        /// includes GetThumbStartCorrection, so ForwardKinematics matches HandPose::FromHandAngles. Allocates while
+        /// reading the model; intended to run once when the profile changes. </summary>
+        static HandGeometry FromModel(const BasicHandModel& profile)
+        {
+            HandGeometry geometry;
+            std::memset(&geometry, 0, sizeof(HandGeometry));
+            geometry.bRightHanded = profile.IsRight();
+
+            const uint32_t maxFingers = FlatHandPose::MaxFingers;
+            const uint32_t maxJoints = FlatHandPose::MaxJoints;
+            const std::vector<Vect3D>& positions = profile.GetStartJointPositions();
+            const std::vector<Quat>& rotations = profile.GetStartJointRotations();
+            for (uint32_t f = 0; f < maxFingers && f < positions.size() && f < rotations.size(); ++f) {
+                geometry.StartPositions[f][0] = positions[f].GetX();
+                geometry.StartPositions[f][1] = positions[f].GetY();
+                geometry.StartPositions[f][2] = positions[f].GetZ();
+                const Quat startRotation = f == static_cast<uint32_t>(EFinger::Thumb)
+                                           ? GetThumbStartCorrection(geometry.bRightHanded) * rotations[f]
+                                           : rotations[f];
+                geometry.StartRotations[f][0] = startRotation.GetX();
+                geometry.StartRotations[f][1] = startRotation.GetY();
+                geometry.StartRotations[f][2] = startRotation.GetZ();
+                geometry.StartRotations[f][3] = startRotation.GetW();
+
+                const std::vector<Vect3D> lengths = profile.Get3DLengths(static_cast<EFinger>(f));
+                const uint32_t lengthCount = lengths.size() < maxJoints - 1
+                                             ? static_cast<uint32_t>(lengths.size()) : maxJoints - 1;
+                for (uint32_t j = 0; j < lengthCount; ++j) {
+                    geometry.Lengths[f][j][0] = lengths[j].GetX();
+                    geometry.Lengths[f][j][1] = lengths[j].GetY();
+                    geometry.Lengths[f][j][2] = lengths[j].GetZ();
+                }
+                geometry.JointCount[f] = static_cast<uint8_t>(lengthCount + 1);
+            }
+            return geometry;
+        }
+    };
+
+public:
+    /// <summary> Name of the instruction set used by ForwardKinematics in this build. </summary>
+    SG_NODISCARD static const char* GetSimdName()
+    {
+#if SG_FK_SIMD_AVX2
+        return "AVX2";
+#elif SG_FK_SIMD_SSE
+        return "SSE2";
+#elif SG_FK_SIMD_NEON
+        return "NEON";
+#else   /* SG_FK_SIMD_AVX2 */
+        return "Scalar";
+#endif  /* SG_FK_SIMD_AVX2 */
+    }
+
+    /// <summary> Amount of chains solved per instruction in this build. </summary>
+    SG_NODISCARD static uint32_t GetLaneWidth()
+    {
+#if SG_FK_SIMD_AVX2
+        return 8;
+#elif SG_FK_SIMD_SSE || SG_FK_SIMD_NEON
+        return 4;
+#else   /* SG_FK_SIMD_AVX2 */
+        return 1;
+#endif  /* SG_FK_SIMD_AVX2 */
+    }
+
+    //--------------------------------------------------------------------------------------
+    // Chains
+
+    /// <summary> Solve all chains in input, using the widest instruction set available. Does not allocate.
+    /// </summary>
+    static void ForwardKinematics(const ChainInput& input, const ChainOutput& out_result)
+    {
+        uint32_t chain = 0;
+#if SG_FK_SIMD_AVX2
+        chain = SolveLanes<LanesAvx>(input, out_result, chain);
+#endif  /* SG_FK_SIMD_AVX2 */
+#if SG_FK_SIMD_SSE
+        chain = SolveLanes<LanesSse>(input, out_result, chain);
+#endif  /* SG_FK_SIMD_SSE */
+#if SG_FK_SIMD_NEON
+        chain = SolveLanes<LanesNeon>(input, out_result, chain);
+#endif  /* SG_FK_SIMD_NEON */
+        SolveLanes<LanesScalar>(input, out_result, chain);
+    }
+
+    /// <summary> Solve all chains in input without any SIMD instructions. Same results as ForwardKinematics;
+    /// useful as a reference. </summary>
+    static void ForwardKinematicsScalar(const ChainInput& input, const ChainOutput& out_result)
+    {
+        SolveLanes<LanesScalar>(input, out_result, 0);
+    }
+
+    //--------------------------------------------------------------------------------------
+    // Hands
+
+    /// <summary> Solve all fingers of one hand in a single batch. Reads HandAngles from handAngles and writes
+    /// joint positions and rotations (and a copy of the angles) to out_handPose. Does not allocate. </summary>
+    static void ForwardKinematics(const HandGeometry& geometry, const FlatHandPose& handAngles,
+                                  FlatHandPose& out_handPose)
+    {
+        ForwardKinematics(geometry, &handAngles, &out_handPose, 1);
+    }
+
+    /// <summary> Solve handCount hands that share the same geometry, e.g. a replayed recording. handAngles and
+    /// out_handPoses must both hold handCount poses. Does not allocate. </summary>
+    static void ForwardKinematics(const HandGeometry& geometry, const FlatHandPose* handAngles,
+                                  FlatHandPose* out_handPoses, uint32_t handCount)
+    {
+        const uint32_t blockSize = HandsPerBlock;
+        for (uint32_t first = 0; first < handCount; first += blockSize) {
+            const uint32_t count = handCount - first < blockSize ? handCount - first : blockSize;
+            SolveHandBlock(geometry, handAngles + first, out_handPoses + first, count);
+        }
+    }
+
+private:
+    //--------------------------------------------------------------------------------------
+    // Lanes: a minimal set of float vector operations for each instruction set.
+
+    struct LanesScalar
+    {
+        static constexpr uint32_t Width = 1;
+        float V;
+
+        static SG_FORCEINLINE LanesScalar Set(float value) { return LanesScalar{value}; }
+        static SG_FORCEINLINE LanesScalar Load(const float* source) { return LanesScalar{*source}; }
+        SG_FORCEINLINE void Store(float* target) const { *target = V; }
+        // Ties may round differently from the SIMD paths; any integer works for the range reduction.
+        static SG_FORCEINLINE LanesScalar Round(LanesScalar a) { return LanesScalar{std::floor(a.V + 0.5f)}; }
+        friend SG_FORCEINLINE LanesScalar operator+(LanesScalar a, LanesScalar b) { return LanesScalar{a.V + b.V}; }
+        friend SG_FORCEINLINE LanesScalar operator-(LanesScalar a, LanesScalar b) { return LanesScalar{a.V - b.V}; }
+        friend SG_FORCEINLINE LanesScalar operator*(LanesScalar a, LanesScalar b) { return LanesScalar{a.V * b.V}; }
+    };
+
+#if SG_FK_SIMD_SSE
+    struct LanesSse
+    {
+        static constexpr uint32_t Width = 4;
+        __m128 V;
+
+        static SG_FORCEINLINE LanesSse Set(float value) { return LanesSse{_mm_set1_ps(value)}; }
+        static SG_FORCEINLINE LanesSse Load(const float* source) { return LanesSse{_mm_loadu_ps(source)}; }
+        SG_FORCEINLINE void Store(float* target) const { _mm_storeu_ps(target, V); }
+        static SG_FORCEINLINE LanesSse Round(LanesSse a) { return LanesSse{_mm_cvtepi32_ps(_mm_cvtps_epi32(a.V))}; }
+        friend SG_FORCEINLINE LanesSse operator+(LanesSse a, LanesSse b) { return LanesSse{_mm_add_ps(a.V, b.V)}; }
+        friend SG_FORCEINLINE LanesSse operator-(LanesSse a, LanesSse b) { return LanesSse{_mm_sub_ps(a.V, b.V)}; }
+        friend SG_FORCEINLINE LanesSse operator*(LanesSse a, LanesSse b) { return LanesSse{_mm_mul_ps(a.V, b.V)}; }
+    };
+#endif  /* SG_FK_SIMD_SSE */
+
+#if SG_FK_SIMD_AVX2
+    struct LanesAvx
+    {
+        static constexpr uint32_t Width = 8;
+        __m256 V;
+
+        static SG_FORCEINLINE LanesAvx Set(float value) { return LanesAvx{_mm256_set1_ps(value)}; }
+        static SG_FORCEINLINE LanesAvx Load(const float* source) { return LanesAvx{_mm256_loadu_ps(source)}; }
+        SG_FORCEINLINE void Store(float* target) const { _mm256_storeu_ps(target, V); }
+        static SG_FORCEINLINE LanesAvx Round(LanesAvx a)
+        {
+            return LanesAvx{_mm256_round_ps(a.V, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC)};
+        }
+        friend SG_FORCEINLINE LanesAvx operator+(LanesAvx a, LanesAvx b) { return LanesAvx{_mm256_add_ps(a.V, b.V)}; }
+        friend SG_FORCEINLINE LanesAvx operator-(LanesAvx a, LanesAvx b) { return LanesAvx{_mm256_sub_ps(a.V, b.V)}; }
+        friend SG_FORCEINLINE LanesAvx operator*(LanesAvx a, LanesAvx b) { return LanesAvx{_mm256_mul_ps(a.V, b.V)}; }
+    };
+#endif  /* SG_FK_SIMD_AVX2 */
+
+#if SG_FK_SIMD_NEON
+    struct LanesNeon
+    {
+        static constexpr uint32_t Width = 4;
+        float32x4_t V;
+
+        static SG_FORCEINLINE LanesNeon Set(float value) { return LanesNeon{vdupq_n_f32(value)}; }
+        static SG_FORCEINLINE LanesNeon Load(const float* source) { return LanesNeon{vld1q_f32(source)}; }
+        SG_FORCEINLINE void Store(float* target) const { vst1q_f32(target, V); }
+        static SG_FORCEINLINE LanesNeon Round(LanesNeon a) { return LanesNeon{vrndnq_f32(a.V)}; }
+        friend SG_FORCEINLINE LanesNeon operator+(LanesNeon a, LanesNeon b) { return LanesNeon{vaddq_f32(a.V, b.V)}; }
+        friend SG_FORCEINLINE LanesNeon operator-(LanesNeon a, LanesNeon b) { return LanesNeon{vsubq_f32(a.V, b.V)}; }
+        friend SG_FORCEINLINE LanesNeon operator*(LanesNeon a, LanesNeon b) { return LanesNeon{vmulq_f32(a.V, b.V)}; }
+    };
+#endif  /* SG_FK_SIMD_NEON */
+
+    //--------------------------------------------------------------------------------------
+    // Kernel
+
+    /// <summary> Sine and cosine of x. Reduces x to [-pi/4, pi/4] around the nearest multiple of pi/2 and uses the
+    /// Cephes minimax polynomials there; accurate to a few ulp for the angles a hand can make. </summary>
+    template<typename L>
+    static SG_FORCEINLINE void SinCos(L x, L& out_sin, L& out_cos)
+    {
+        const L quadrant = L::Round(x * L::Set(0.63661977236758134f));// x / (pi / 2)
+        // Cody-Waite: subtract quadrant * pi / 2 in three parts to keep the precision of r.
+        const L r = ((x - quadrant * L::Set(1.5703125f)) - quadrant * L::Set(4.837512969970703125e-4f))
+                    - quadrant * L::Set(7.54978995489188216e-8f);
+        const L r2 = r * r;
+        const L sinR = r + r * r2 * (L::Set(-1.6666654611e-1f)
+                                     + r2 * (L::Set(8.3321608736e-3f) + r2 * L::Set(-1.9515295891e-4f)));
+        const L cosR = L::Set(1.0f) - L::Set(0.5f) * r2
+                       + r2 * r2 * (L::Set(4.166664568298827e-2f)
+                                    + r2 * (L::Set(-1.388731625493765e-3f) + r2 * L::Set(2.443315711809948e-5f)));
+
+        // Quadrant modulo 4, as 0/1 floats: the quadrant is a whole number, so these roundings are exact.
+        const L one = L::Set(1.0f);
+        const L two = L::Set(2.0f);
+        const L mod4 = quadrant - L::Set(4.0f) * L::Round(quadrant * L::Set(0.25f) - L::Set(0.375f));
+        const L high = L::Round(mod4 * L::Set(0.5f) - L::Set(0.25f));// quadrant 2 or 3
+        const L odd = mod4 - two * high;                              // quadrant 1 or 3
+        const L cosNegative = odd + high - two * odd * high;          // quadrant 1 or 2
+
+        const L sinBase = sinR + odd * (cosR - sinR);
+        const L cosBase = cosR + odd * (sinR - cosR);
+        out_sin = sinBase * (one - two * high);
+        out_cos = cosBase * (one - two * cosNegative);
+    }
+
+    /// <summary> Solve the chains [first, first + k * L::Width) that fit in whole lanes. Returns the first chain
+    /// that was not solved. </summary>
+    template<typename L>
+    static uint32_t SolveLanes(const ChainInput& input, const ChainOutput& out_result, uint32_t first)
+    {
+        const uint32_t width = L::Width;
+        const uint32_t stride = input.ChainCount;
+        uint32_t c = first;
+        for (; c + width <= input.ChainCount; c += width) {
+            L px = L::Load(input.StartPositionX + c);
+            L py = L::Load(input.StartPositionY + c);
+            L pz = L::Load(input.StartPositionZ + c);
+            L qx = L::Load(input.StartRotationX + c);
+            L qy = L::Load(input.StartRotationY + c);
+            L qz = L::Load(input.StartRotationZ + c);
+            L qw = L::Load(input.StartRotationW + c);
+
+            for (uint32_t j = 0; j < input.JointCount; ++j) {
+                const uint32_t index = j * stride + c;
+                if (j > 0) {
+                    // Next joint = previous joint + previous rotation * length in between.
+                    const uint32_t lengthIndex = (j - 1) * stride + c;
+                    const L lx = L::Load(input.LengthX + lengthIndex);
+                    const L ly = L::Load(input.LengthY + lengthIndex);
+                    const L lz = L::Load(input.LengthZ + lengthIndex);
+                    const L tx = L::Set(2.0f) * (qy * lz - qz * ly);
+                    const L ty = L::Set(2.0f) * (qz * lx - qx * lz);
+                    const L tz = L::Set(2.0f) * (qx * ly - qy * lx);
+                    px = px + lx + qw * tx + (qy * tz - qz * ty);
+                    py = py + ly + qw * ty + (qz * tx - qx * tz);
+                    pz = pz + lz + qw * tz + (qx * ty - qy * tx);
+                }
+                px.Store(out_result.PositionX + index);
+                py.Store(out_result.PositionY + index);
+                pz.Store(out_result.PositionZ + index);
+
+                // Quat::FromEuler: heading around y, attitude around z, bank around x.
+                L s1, c1, s2, c2, s3, c3;
+                const L half = L::Set(0.5f);
+                SinCos(L::Load(input.AngleY + index) * half, s1, c1);
+                SinCos(L::Load(input.AngleZ + index) * half, s2, c2);
+                SinCos(L::Load(input.AngleX + index) * half, s3, c3);
+                const L c1c2 = c1 * c2;
+                const L s1s2 = s1 * s2;
+                const L ew = c1c2 * c3 + s1s2 * s3;
+                const L ex = c1c2 * s3 - s1s2 * c3;
+                const L ey = s1 * c2 * c3 + c1 * s2 * s3;
+                const L ez = c1 * s2 * c3 - s1 * c2 * s3;
+
+                // Rotation = previous rotation * joint rotation.
+                const L nw = qw * ew - qx * ex - qy * ey - qz * ez;
+                const L nx = qw * ex + qx * ew + qy * ez - qz * ey;
+                const L ny = qw * ey - qx * ez + qy * ew + qz * ex;
+                const L nz = qw * ez + qx * ey - qy * ex + qz * ew;
+                qx = nx;
+                qy = ny;
+                qz = nz;
+                qw = nw;
+                qx.Store(out_result.RotationX + index);
+                qy.Store(out_result.RotationY + index);
+                qz.Store(out_result.RotationZ + index);
+                qw.Store(out_result.RotationW + index);
+            }
+        }
+        return c;
+    }
+
+    //--------------------------------------------------------------------------------------
+    // Hands
+
+    /// <summary> Hands gathered into one structure-of-arrays batch; keeps the stack buffers under 10 KB. </summary>
+    static constexpr uint32_t HandsPerBlock = 8;
+
+    static void SolveHandBlock(const HandGeometry& geometry, const FlatHandPose* handAngles,
+                               FlatHandPose* out_handPoses, uint32_t handCount)
+    {
+        const uint32_t fingers = FlatHandPose::MaxFingers;
+        const uint32_t joints = FlatHandPose::MaxJoints;
+        const uint32_t maxChains = HandsPerBlock * FlatHandPose::MaxFingers;
+        const uint32_t chains = handCount * fingers;
+
+        // Joint-major SoA buffers. Joints beyond a finger's JointCount are padded with zeroes and ignored.
+        float start[7][maxChains];
+        float lengths[3][(FlatHandPose::MaxJoints - 1) * maxChains];
+        float angles[3][FlatHandPose::MaxJoints * maxChains];
+        float result[7][FlatHandPose::MaxJoints * maxChains];
+        std::memset(lengths, 0, sizeof(lengths));
+        std::memset(angles, 0, sizeof(angles));
+
+        for (uint32_t h = 0; h < handCount; ++h) {
+            const FlatHandPose& pose = handAngles[h];
+            for (uint32_t f = 0; f < fingers; ++f) {
+                const uint32_t c = h * fingers + f;
+                for (uint32_t i = 0; i < 3; ++i) {
+                    start[i][c] = geometry.StartPositions[f][i];
+                }
+                for (uint32_t i = 0; i < 4; ++i) {
+                    start[3 + i][c] = geometry.StartRotations[f][i];
+                }
+                for (uint32_t j = 0; j + 1 < geometry.JointCount[f]; ++j) {
+                    for (uint32_t i = 0; i < 3; ++i) {
+                        lengths[i][j * chains + c] = geometry.Lengths[f][j][i];
+                    }
+                }
+                for (uint32_t j = 0; j < pose.AngleCount[f] && j < joints; ++j) {
+                    for (uint32_t i = 0; i < 3; ++i) {
+                        angles[i][j * chains + c] = pose.HandAngles[f][j][i];
+                    }
+                }
+            }
+        }
+
+        const ChainInput input{chains, joints,
+                               start[0], start[1], start[2], start[3], start[4], start[5], start[6],
+                               lengths[0], lengths[1], lengths[2],
+                               angles[0], angles[1], angles[2]};
+        const ChainOutput output{result[0], result[1], result[2], result[3], result[4], result[5], result[6]};
+        ForwardKinematics(input, output);
+
+        for (uint32_t h = 0; h < handCount; ++h) {
+            FlatHandPose& out_pose = out_handPoses[h];
+            const FlatHandPose& pose = handAngles[h];
+            if (&out_pose != &pose) {
+                std::memcpy(out_pose.AngleCount, pose.AngleCount, sizeof(pose.AngleCount));
+                std::memcpy(out_pose.HandAngles, pose.HandAngles, sizeof(pose.HandAngles));
+            }
+            out_pose.bRightHanded = geometry.bRightHanded;
+            for (uint32_t f = 0; f < fingers; ++f) {
+                const uint32_t c = h * fingers + f;
+                out_pose.JointCount[f] = geometry.JointCount[f];
+                for (uint32_t j = 0; j < geometry.JointCount[f]; ++j) {
+                    for (uint32_t i = 0; i < 3; ++i) {
+                        out_pose.JointPositions[f][j][i] = result[i][j * chains + c];
+                    }
+                    for (uint32_t i = 0; i < 4; ++i) {
+                        out_pose.JointRotations[f][j][i] = result[3 + i][j * chains + c];
+                    }
+                }
+            }
+            out_pose.bValid = true;
+        }
+    }
+
+public:
+    JointKinematicsBatch() = delete;
+    ~JointKinematicsBatch() = delete;
+};
+
+static_assert(std::is_trivially_copyable<SGCore::Kinematics::JointKinematicsBatch::HandGeometry>::value,
+              "HandGeometry is re-used across frames and threads, and must remain trivially copyable.");
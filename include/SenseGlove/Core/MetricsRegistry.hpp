@@ -0,0 +1,418 @@
+/**
+ * @file
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2026 SenseGlove
+ *
+ * @section DESCRIPTION
+ *
+ * Operational telemetry per device: atomic counters for parsing, stale
+ * reads, haptic writes and calibration, plus latency histograms. Can be
+ * read as a snapshot, or dumped in the Prometheus text format.
+ */
+
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "DeviceList.hpp"
+#include "HapticGlove.hpp"
+#include "PipelineLatency.hpp"
+#include "Platform.hpp"
+#include "SGDevice.hpp"
+
+namespace SGCore
+{
+    namespace Diagnostics
+    {
+        /// <summary> Counters kept for every device. </summary>
+        enum class EDeviceCounter : uint8_t
+        {
+            /// <summary> Sensor samples that were turned into a hand pose. </summary>
+            PacketsParsed = 0,
+
+            /// <summary> Attempts to turn a sensor sample into a hand pose that failed. </summary>
+            ParseFailures,
+
+            /// <summary> Reads that returned a result for a sample that was already read before. </summary>
+            StaleReads,
+
+            /// <summary> Haptic commands that were sent to SenseCom. </summary>
+            HapticWrites,
+
+            /// <summary> Haptic commands that were not sent, because they did not change. </summary>
+            SuppressedWrites,
+
+            /// <summary> Haptic commands that could not be written to SenseCom. </summary>
+            IpcWriteFailures,
+
+            /// <summary> Changes of the glove's EHapticGloveCalibrationState. </summary>
+            CalibrationTransitions
+        };
+
+        /// <summary> Latency histograms kept for every device. </summary>
+        enum class EDeviceHistogram : uint8_t
+        {
+            /// <summary> Time from receiving a sensor sample to the hand pose calculated from it. </summary>
+            PoseLatency = 0,
+
+            /// <summary> Time spent sending a haptic command to SenseCom. </summary>
+            HapticSendDuration
+        };
+
+        /// <summary> The counters, gauges and histograms of a single device. </summary>
+        class DeviceMetrics;
+
+        /// <summary> A copy of a single device's metrics at one point in time. </summary>
+        struct DeviceMetricsSnapshot;
+
+        /// <summary> Process-wide registry of DeviceMetrics, keyed by device index. </summary>
+        class MetricsRegistry;
+    }// namespace Diagnostics
+}// namespace SGCore
+
+/// <summary> The counters, gauges and histograms of a single device. </summary>
+/// <remarks> Every function may be called from any thread; updates are relaxed atomics, so a reader may see one
+/// counter updated before another. Hot paths should look up their DeviceMetrics once through
+/// MetricsRegistry::ForDevice, and keep the reference; it stays valid for the lifetime of the process. </remarks>
+class SGCore::Diagnostics::DeviceMetrics
+{
+public:
+    /// <summary> Amount of values in EDeviceCounter. </summary>
+    static constexpr uint32_t CounterCount = 7;
+
+    /// <summary> Amount of values in EDeviceHistogram. </summary>
+    static constexpr uint32_t HistogramCount = 2;
+
+private:
+    int32_t DeviceIndex;
+    std::atomic<uint64_t> Counters[CounterCount];
+    Util::LatencyHistogram Histograms[HistogramCount];
+    std::atomic<int32_t> CalibrationState{-1};
+    std::atomic<int32_t> PacketsPerSecondReceived{0};
+    std::atomic<int32_t> PacketsPerSecondSent{0};
+
+public:
+    explicit DeviceMetrics(int32_t deviceIndex)
+        : DeviceIndex(deviceIndex)
+    {
+        Reset();
+    }
+
+    DeviceMetrics(const DeviceMetrics& rhs) = delete;
+
+    ~DeviceMetrics() = default;
+
+public:
+    DeviceMetrics& operator=(const DeviceMetrics& rhs) = delete;
+
+public:
+    /// <summary> The device these metrics belong to. </summary>
+    SG_NODISCARD int32_t GetDeviceIndex() const
+    {
+        return DeviceIndex;
+    }
+
+    //--------------------------------------------------------------------------------------
+    // Recording
+
+    /// <summary> Add amount to a counter. </summary>
+    void Increment(EDeviceCounter counter, uint64_t amount = 1)
+    {
+        Counters[static_cast<uint32_t>(counter)].fetch_add(amount, std::memory_order_relaxed);
+    }
+
+    /// <summary> Add a latency, in nanoseconds, to a histogram. </summary>
+    void Record(EDeviceHistogram histogram, uint64_t latencyNs)
+    {
+        Histograms[static_cast<uint32_t>(histogram)].Record(latencyNs);
+    }
+
+    /// <summary> Report the glove's current calibration state. Counts a CalibrationTransitions whenever it differs
+    /// from the last reported state. </summary>
+    void RecordCalibrationState(EHapticGloveCalibrationState state)
+    {
+        const int32_t value = static_cast<int32_t>(state);
+        const int32_t previous = CalibrationState.exchange(value, std::memory_order_relaxed);
+        if (previous >= 0 && previous != value) {
+            Increment(EDeviceCounter::CalibrationTransitions);
+        }
+    }
+
+    /// <summary> Copy the packet rates SGDevice reports into the gauges of this device. </summary>
+    void RecordPacketRates(const SGDevice& device)
+    {
+        PacketsPerSecondReceived.store(device.PacketsPerSecondReceived(), std::memory_order_relaxed);
+        PacketsPerSecondSent.store(device.PacketsPerSecondSent(), std::memory_order_relaxed);
+    }
+
+    /// <summary> Reset all counters, gauges and histograms. </summary>
+    void Reset()
+    {
+        for (std::atomic<uint64_t>& counter : Counters) {
+            counter.store(0, std::memory_order_relaxed);
+        }
+        for (Util::LatencyHistogram& histogram : Histograms) {
+            histogram.Reset();
+        }
+        CalibrationState.store(-1, std::memory_order_relaxed);
+        PacketsPerSecondReceived.store(0, std::memory_order_relaxed);
+        PacketsPerSecondSent.store(0, std::memory_order_relaxed);
+    }
+
+    //--------------------------------------------------------------------------------------
+    // Reading
+
+    /// <summary> Current value of a counter. </summary>
+    SG_NODISCARD uint64_t Get(EDeviceCounter counter) const
+    {
+        return Counters[static_cast<uint32_t>(counter)].load(std::memory_order_relaxed);
+    }
+
+    /// <summary> One of the latency histograms. </summary>
+    SG_NODISCARD const Util::LatencyHistogram& GetHistogram(EDeviceHistogram histogram) const
+    {
+        return Histograms[static_cast<uint32_t>(histogram)];
+    }
+
+    /// <summary> Copy all metrics into out_snapshot. </summary>
+    void TakeSnapshot(DeviceMetricsSnapshot& out_snapshot) const;
+};
+
+/// <summary> A copy of a single device's metrics at one point in time. </summary>
+struct SGCore::Diagnostics::DeviceMetricsSnapshot
+{
+    /// <summary> Summary of a single latency histogram, in nanoseconds. </summary>
+    struct HistogramSummary
+    {
+        uint64_t Count;
+        uint64_t SumNs;
+        uint64_t MeanNs;
+        uint64_t P50Ns;
+        uint64_t P99Ns;
+        uint64_t MaxNs;
+
+        /// <summary> Cumulative counts per LatencyHistogram bucket, as Prometheus expects them. </summary>
+        uint64_t CumulativeBuckets[Util::LatencyHistogram::BucketCount];
+    };
+
+    int32_t DeviceIndex;
+    uint64_t Counters[DeviceMetrics::CounterCount];
+    HistogramSummary Histograms[DeviceMetrics::HistogramCount];
+
+    /// <summary> Last reported EHapticGloveCalibrationState, or -1 if none was reported. </summary>
+    int32_t CalibrationState;
+
+    int32_t PacketsPerSecondReceived;
+    int32_t PacketsPerSecondSent;
+
+    /// <summary> Value of a counter. </summary>
+    SG_NODISCARD uint64_t Get(EDeviceCounter counter) const
+    {
+        return Counters[static_cast<uint32_t>(counter)];
+    }
+
+    /// <summary> Summary of a histogram. </summary>
+    SG_NODISCARD const HistogramSummary& GetHistogram(EDeviceHistogram histogram) const
+    {
+        return Histograms[static_cast<uint32_t>(histogram)];
+    }
+};
+
+inline void SGCore::Diagnostics::DeviceMetrics::TakeSnapshot(DeviceMetricsSnapshot& out_snapshot) const
+{
+    out_snapshot.DeviceIndex = DeviceIndex;
+    for (uint32_t i = 0; i < CounterCount; ++i) {
+        out_snapshot.Counters[i] = Counters[i].load(std::memory_order_relaxed);
+    }
+    for (uint32_t i = 0; i < HistogramCount; ++i) {
+        const Util::LatencyHistogram& histogram = Histograms[i];
+        DeviceMetricsSnapshot::HistogramSummary& summary = out_snapshot.Histograms[i];
+        uint64_t cumulative = 0;
+        for (uint32_t bucket = 0; bucket < Util::LatencyHistogram::BucketCount; ++bucket) {
+            cumulative += histogram.GetBucketCount(bucket);
+            summary.CumulativeBuckets[bucket] = cumulative;
+        }
+        summary.Count = cumulative;
+        summary.SumNs = histogram.GetSumNs();
+        summary.MeanNs = histogram.GetMeanNs();
+        summary.P50Ns = histogram.GetPercentileNs(0.5f);
+        summary.P99Ns = histogram.GetPercentileNs(0.99f);
+        summary.MaxNs = histogram.GetMaxNs();
+    }
+    out_snapshot.CalibrationState = CalibrationState.load(std::memory_order_relaxed);
+    out_snapshot.PacketsPerSecondReceived = PacketsPerSecondReceived.load(std::memory_order_relaxed);
+    out_snapshot.PacketsPerSecondSent = PacketsPerSecondSent.load(std::memory_order_relaxed);
+}
+
+/// <summary> Process-wide registry of DeviceMetrics, keyed by device index. </summary>
+/// <remarks> HapticsTransaction (and so HapticsScheduler) and HandPoseCache report into it automatically.
+/// Applications can poll TakeSnapshot, or serve WritePrometheus from their own HTTP endpoint. </remarks>
+class SGCore::Diagnostics::MetricsRegistry
+{
+private:
+    struct Storage
+    {
+        std::mutex Mutex;
+        std::map<int32_t, std::unique_ptr<DeviceMetrics>> Devices;
+    };
+
+public:
+    /// <summary> The metrics of a device, created on first use. The reference stays valid for the lifetime of the
+    /// process. Takes a lock; look it up once, not per sample. </summary>
+    static DeviceMetrics& ForDevice(int32_t deviceIndex)
+    {
+        Storage& storage = GetStorage();
+        std::lock_guard<std::mutex> lock(storage.Mutex);
+        std::unique_ptr<DeviceMetrics>& metrics = storage.Devices[deviceIndex];
+        if (metrics == nullptr) {
+            metrics.reset(new DeviceMetrics(deviceIndex));
+        }
+        return *metrics;
+    }
+
+    /// <summary> Update the packet rate gauges of every device that is currently known to DeviceList. </summary>
+    static void CollectPacketRates()
+    {
+        for (const std::shared_ptr<SGDevice>& device : DeviceList::GetDevices()) {
+            if (device != nullptr) {
+                ForDevice(device->GetDeviceIndex()).RecordPacketRates(*device);
+            }
+        }
+    }
+
+    /// <summary> Copy the metrics of every device into out_snapshots, ordered by device index. Re-use
+    /// out_snapshots between calls to avoid allocations. </summary>
+    static void TakeSnapshot(std::vector<DeviceMetricsSnapshot>& out_snapshots)
+    {
+        Storage& storage = GetStorage();
+        std::lock_guard<std::mutex> lock(storage.Mutex);
+        out_snapshots.resize(storage.Devices.size());
+        std::size_t i = 0;
+        for (const std::pair<const int32_t, std::unique_ptr<DeviceMetrics>>& device : storage.Devices) {
+            device.second->TakeSnapshot(out_snapshots[i++]);
+        }
+    }
+
+    /// <summary> Reset the metrics of every device. </summary>
+    static void ResetAll()
+    {
+        Storage& storage = GetStorage();
+        std::lock_guard<std::mutex> lock(storage.Mutex);
+        for (const std::pair<const int32_t, std::unique_ptr<DeviceMetrics>>& device : storage.Devices) {
+            device.second->Reset();
+        }
+    }
+
+    //--------------------------------------------------------------------------------------
+    // Prometheus
+
+    /// <summary> Write the metrics of every device in the Prometheus text exposition format, labelled with
+    /// device="index". Latencies are exported in seconds. </summary>
+    static void WritePrometheus(std::ostream& out_stream)
+    {
+        std::vector<DeviceMetricsSnapshot> snapshots;
+        TakeSnapshot(snapshots);
+
+        static const char* const counterNames[DeviceMetrics::CounterCount] = {
+                "sgcore_packets_parsed_total", "sgcore_parse_failures_total", "sgcore_stale_reads_total",
+                "sgcore_haptic_writes_total", "sgcore_haptic_suppressed_writes_total",
+                "sgcore_ipc_write_failures_total", "sgcore_calibration_transitions_total"};
+        static const char* const counterHelp[DeviceMetrics::CounterCount] = {
+                "Sensor samples turned into a hand pose.", "Failed attempts to calculate a hand pose.",
+                "Reads of a sample that was already read before.", "Haptic commands sent to SenseCom.",
+                "Haptic commands skipped because they did not change.",
+                "Haptic commands that could not be written to SenseCom.", "Calibration state changes."};
+        for (uint32_t i = 0; i < DeviceMetrics::CounterCount; ++i) {
+            WriteHeader(out_stream, counterNames[i], counterHelp[i], "counter");
+            for (const DeviceMetricsSnapshot& snapshot : snapshots) {
+                out_stream << counterNames[i] << "{device=\"" << snapshot.DeviceIndex << "\"} "
+                           << snapshot.Counters[i] << "\n";
+            }
+        }
+
+        WriteHeader(out_stream, "sgcore_calibration_state", "Last reported EHapticGloveCalibrationState.", "gauge");
+        for (const DeviceMetricsSnapshot& snapshot : snapshots) {
+            out_stream << "sgcore_calibration_state{device=\"" << snapshot.DeviceIndex << "\"} "
+                       << snapshot.CalibrationState << "\n";
+        }
+        WriteHeader(out_stream, "sgcore_packets_per_second_received", "Packets per second received.", "gauge");
+        for (const DeviceMetricsSnapshot& snapshot : snapshots) {
+            out_stream << "sgcore_packets_per_second_received{device=\"" << snapshot.DeviceIndex << "\"} "
+                       << snapshot.PacketsPerSecondReceived << "\n";
+        }
+        WriteHeader(out_stream, "sgcore_packets_per_second_sent", "Packets per second sent.", "gauge");
+        for (const DeviceMetricsSnapshot& snapshot : snapshots) {
+            out_stream << "sgcore_packets_per_second_sent{device=\"" << snapshot.DeviceIndex << "\"} "
+                       << snapshot.PacketsPerSecondSent << "\n";
+        }
+
+        static const char* const histogramNames[DeviceMetrics::HistogramCount] = {
+                "sgcore_pose_latency_seconds", "sgcore_haptic_send_duration_seconds"};
+        static const char* const histogramHelp[DeviceMetrics::HistogramCount] = {
+                "Time from receiving a sensor sample to its hand pose.", "Time spent sending a haptic command."};
+        for (uint32_t i = 0; i < DeviceMetrics::HistogramCount; ++i) {
+            WriteHeader(out_stream, histogramNames[i], histogramHelp[i], "histogram");
+            for (const DeviceMetricsSnapshot& snapshot : snapshots) {
+                WriteHistogram(out_stream, histogramNames[i], snapshot.DeviceIndex, snapshot.Histograms[i]);
+            }
+        }
+    }
+
+    /// <summary> As WritePrometheus(out_stream), into a new string. </summary>
+    SG_NODISCARD static std::string ToPrometheusText()
+    {
+        std::ostringstream stream;
+        WritePrometheus(stream);
+        return stream.str();
+    }
+
+private:
+    static Storage& GetStorage()
+    {
+        static Storage storage;
+        return storage;
+    }
+
+    static void WriteHeader(std::ostream& out_stream, const char* name, const char* help, const char* type)
+    {
+        out_stream << "# HELP " << name << " " << help << "\n# TYPE " << name << " " << type << "\n";
+    }
+
+    /// <summary> Format seconds into out_buffer the same way regardless of the flags of the stream. </summary>
+    static const char* FormatSeconds(uint64_t nanoseconds, char (&out_buffer)[32])
+    {
+        std::snprintf(out_buffer, sizeof(out_buffer), "%.9g", static_cast<double>(nanoseconds) * 1e-9);
+        return out_buffer;
+    }
+
+    static void WriteHistogram(std::ostream& out_stream, const char* name, int32_t deviceIndex,
+                               const DeviceMetricsSnapshot::HistogramSummary& summary)
+    {
+        // LatencyHistogram bounds are inclusive, as le is. Its last bucket is open-ended, and becomes the +Inf bucket.
+        char buffer[32];
+        for (uint32_t bucket = 0; bucket + 1 < Util::LatencyHistogram::BucketCount; ++bucket) {
+            const char* bound = FormatSeconds(Util::LatencyHistogram::GetBucketUpperBoundNs(bucket), buffer);
+            out_stream << name << "_bucket{device=\"" << deviceIndex << "\",le=\"" << bound << "\"} "
+                       << summary.CumulativeBuckets[bucket] << "\n";
+        }
+        out_stream << name << "_bucket{device=\"" << deviceIndex << "\",le=\"+Inf\"} " << summary.Count << "\n"
+                   << name << "_sum{device=\"" << deviceIndex << "\"} " << FormatSeconds(summary.SumNs, buffer)
+                   << "\n" << name << "_count{device=\"" << deviceIndex << "\"} " << summary.Count << "\n";
+    }
+
+public:
+    MetricsRegistry() = delete;
+    virtual ~MetricsRegistry() = delete;
+};
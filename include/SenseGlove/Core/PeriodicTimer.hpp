@@ -0,0 +1,128 @@
+/**
+ * @file
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2026 SenseGlove
+ *
+ * @section DESCRIPTION
+ *
+ * Paces a loop at a fixed period, with an optional spin-wait for the last
+ * part of each period. Shared by the threads of the header-only utilities
+ * that run on a timer: HapticsScheduler, SimulatedBackend and
+ * WaveformSequencer.
+ */
+
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <thread>
+
+#include "Platform.hpp"
+
+namespace SGCore
+{
+    namespace Util
+    {
+        /// <summary> Paces a loop at a fixed period, optionally spinning for the last part of each period.
+        /// </summary>
+        class PeriodicTimer;
+    }// namespace Util
+}// namespace SGCore
+
+/// <summary> Paces a loop at a fixed period, optionally spinning for the last part of each period. </summary>
+/// <remarks> Deadlines are absolute, so the period does not drift with the time spent in the loop body. When the loop
+/// falls more than MaxLagPeriods behind, the timer skips ahead instead of running a burst of periods to catch up.
+/// Not thread-safe; meant to be owned by the thread it paces. </remarks>
+class SGCore::Util::PeriodicTimer
+{
+public:
+    using Clock = std::chrono::steady_clock;
+
+    /// <summary> How long before a deadline a spin-wait stops sleeping and starts yielding. </summary>
+    static SG_FORCEINLINE std::chrono::microseconds GetSpinThreshold()
+    {
+        return std::chrono::microseconds(200);
+    }
+
+    /// <summary> Amount of periods the loop may lag behind before the timer skips ahead. </summary>
+    static constexpr uint32_t MaxLagPeriods = 8;
+
+    /// <summary> Until when to sleep before a deadline, given the current time. Without spinning, that is the
+    /// deadline itself. With spinning, it is GetSpinThreshold() before the deadline, or now once that has passed; the
+    /// caller should then yield and check again. </summary>
+    static Clock::time_point GetSleepDeadline(Clock::time_point deadline, Clock::time_point now, bool bSpinWait)
+    {
+        if (!bSpinWait) {
+            return deadline;
+        }
+        return deadline - now > GetSpinThreshold() ? deadline - GetSpinThreshold() : now;
+    }
+
+    /// <summary> Block the calling thread until the deadline, sleeping and then spinning if bSpinWait is set.
+    /// </summary>
+    static void WaitUntil(Clock::time_point deadline, bool bSpinWait)
+    {
+        const Clock::time_point now = Clock::now();
+        if (!bSpinWait) {
+            std::this_thread::sleep_until(deadline);
+            return;
+        }
+        const Clock::time_point sleepDeadline = GetSleepDeadline(deadline, now, true);
+        if (sleepDeadline > now) {
+            std::this_thread::sleep_until(sleepDeadline);
+        }
+        while (Clock::now() < deadline) {
+            std::this_thread::yield();
+        }
+    }
+
+private:
+    std::chrono::nanoseconds Period;
+    bool bSpinWait;
+    Clock::time_point Next;
+
+public:
+    /// <summary> Create a timer with the given period. The first period starts now. </summary>
+    PeriodicTimer(std::chrono::nanoseconds period, bool bSpin)
+        : Period(period), bSpinWait(bSpin), Next(Clock::now())
+    {
+    }
+
+    /// <summary> Create a timer that fires rateHz times per second, which must be > 0. </summary>
+    PeriodicTimer(uint32_t rateHz, bool bSpin)
+        : PeriodicTimer(std::chrono::nanoseconds(1000000000LL / rateHz), bSpin)
+    {
+    }
+
+    ~PeriodicTimer() = default;
+
+public:
+    SG_NODISCARD std::chrono::nanoseconds GetPeriod() const
+    {
+        return Period;
+    }
+
+    /// <summary> Start counting periods from now. </summary>
+    void Reset()
+    {
+        Next = Clock::now();
+    }
+
+    /// <summary> Wait until the end of the current period. Returns false, without waiting, if the loop fell more
+    /// than MaxLagPeriods behind; the timer then starts over from now. </summary>
+    bool WaitForNextPeriod()
+    {
+        Next += Period;
+        const Clock::time_point now = Clock::now();
+        const uint32_t maxLagPeriods = MaxLagPeriods;
+        if (now > Next + Period * maxLagPeriods) {
+            Next = now;// too far behind to catch up without a burst; skip ahead instead.
+            return false;
+        }
+        WaitUntil(Next, bSpinWait);
+        return true;
+    }
+};
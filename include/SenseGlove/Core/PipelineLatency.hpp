@@ -0,0 +1,346 @@
+/**
+ * @file
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2026 SenseGlove
+ *
+ * @section DESCRIPTION
+ *
+ * Monotonic timestamps for each stage a sensor sample passes on its way to a
+ * hand pose, and lock-free histograms to aggregate the latency between them.
+ * Used to measure how much each stage adds to motion-to-photon latency.
+ */
+
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <type_traits>
+
+#include "Platform.hpp"
+
+namespace SGCore
+{
+    namespace Util
+    {
+        /// <summary> The stages a sensor sample passes on its way to a hand pose, in order. </summary>
+        enum class ELatencyStage : uint8_t
+        {
+            /// <summary> SGConnect received the sample from the device. </summary>
+            Receive = 0,
+
+            /// <summary> The sample was published to shared memory. </summary>
+            Publish,
+
+            /// <summary> SGCore started parsing the sample. </summary>
+            Parse,
+
+            /// <summary> The sensor values were normalized. </summary>
+            Normalize,
+
+            /// <summary> The hand pose was calculated. </summary>
+            Kinematics
+        };
+
+        /// <summary> Monotonic timestamps of each ELatencyStage a sample has passed. </summary>
+        struct PipelineTimestamps;
+
+        /// <summary> Lock-free histogram of latencies, with power-of-two microsecond buckets. </summary>
+        class LatencyHistogram;
+
+        /// <summary> Latency histograms for every stage of a single device's pipeline. </summary>
+        class PipelineLatencyStats;
+    }// namespace Util
+}// namespace SGCore
+
+/// <summary> Monotonic timestamps of each ELatencyStage a sample has passed. </summary>
+/// <remarks> Timestamps are in nanoseconds of steady_clock, as SensorFrame::NowNanoseconds(), so stages in SGConnect
+/// and SGCore can be compared directly. 0 means the stage was not timestamped, e.g. because it happened inside the
+/// library, or because the sample did not come through a SensorChannel. Trivially copyable, so it can be stored in
+/// shared memory and flat structs. </remarks>
+struct SGCore::Util::PipelineTimestamps
+{
+public:
+    /// <summary> Amount of stages in ELatencyStage. </summary>
+    static constexpr uint32_t StageCount = 5;
+
+    /// <summary> The current time, in the same clock as the stored timestamps. </summary>
+    static uint64_t NowNanoseconds()
+    {
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now().time_since_epoch()).count());
+    }
+
+public:
+    /// <summary> Timestamp per stage, indexed by ELatencyStage. </summary>
+    uint64_t StageNs[StageCount];
+
+public:
+    /// <summary> Remove all timestamps. </summary>
+    void Clear()
+    {
+        for (uint64_t& stamp : StageNs) {
+            stamp = 0;
+        }
+    }
+
+    /// <summary> Set the timestamp of a stage. </summary>
+    void Set(ELatencyStage stage, uint64_t timestampNs)
+    {
+        StageNs[static_cast<uint32_t>(stage)] = timestampNs;
+    }
+
+    /// <summary> Set the timestamp of a stage to the current time. </summary>
+    void Stamp(ELatencyStage stage)
+    {
+        Set(stage, NowNanoseconds());
+    }
+
+    /// <summary> The timestamp of a stage, or 0 if it was not timestamped. </summary>
+    SG_NODISCARD uint64_t Get(ELatencyStage stage) const
+    {
+        return StageNs[static_cast<uint32_t>(stage)];
+    }
+
+    /// <summary> Returns true if a stage was timestamped. </summary>
+    SG_NODISCARD bool Has(ELatencyStage stage) const
+    {
+        return Get(stage) != 0;
+    }
+
+    /// <summary> Time between two stages, in nanoseconds. 0 if either was not timestamped, or if to happened before
+    /// from. </summary>
+    SG_NODISCARD uint64_t GetLatencyNs(ELatencyStage from, ELatencyStage to) const
+    {
+        const uint64_t start = Get(from);
+        const uint64_t end = Get(to);
+        return start != 0 && end > start ? end - start : 0;
+    }
+
+    /// <summary> Earliest timestamp of the sample, or 0 if it has none. </summary>
+    SG_NODISCARD uint64_t GetOriginNs() const
+    {
+        for (uint64_t stamp : StageNs) {
+            if (stamp != 0) {
+                return stamp;
+            }
+        }
+        return 0;
+    }
+
+    /// <summary> How old the sample is at nowNs, measured from its earliest timestamp. 0 if it has none. </summary>
+    SG_NODISCARD uint64_t GetAgeNs(uint64_t nowNs) const
+    {
+        const uint64_t origin = GetOriginNs();
+        return origin != 0 && nowNs > origin ? nowNs - origin : 0;
+    }
+
+    /// <summary> How old the sample is right now, measured from its earliest timestamp. </summary>
+    SG_NODISCARD uint64_t GetAgeNs() const
+    {
+        return GetAgeNs(NowNanoseconds());
+    }
+};
+
+static_assert(std::is_trivially_copyable<SGCore::Util::PipelineTimestamps>::value,
+              "PipelineTimestamps is stored in flat structs and must remain trivially copyable.");
+
+/// <summary> Lock-free histogram of latencies, with power-of-two microsecond buckets. </summary>
+/// <remarks> Bucket 0 holds latencies up to and including 1 us; bucket i holds (2^(i-1), 2^i] us. Bounds are
+/// inclusive, like the le buckets of Prometheus. The last bucket also holds everything longer. Record may be called
+/// from any number of threads; readers see a consistent count per bucket, but not necessarily across buckets while
+/// samples are being recorded. </remarks>
+class SGCore::Util::LatencyHistogram
+{
+public:
+    /// <summary> Amount of buckets. The last one starts at about 18 minutes. </summary>
+    static constexpr uint32_t BucketCount = 32;
+
+private:
+    std::atomic<uint64_t> Buckets[BucketCount];
+    std::atomic<uint64_t> Count{0};
+    std::atomic<uint64_t> SumNs{0};
+    std::atomic<uint64_t> MaxNs{0};
+
+public:
+    LatencyHistogram()
+    {
+        Reset();
+    }
+
+    LatencyHistogram(const LatencyHistogram& rhs) = delete;
+
+    ~LatencyHistogram() = default;
+
+public:
+    LatencyHistogram& operator=(const LatencyHistogram& rhs) = delete;
+
+public:
+    /// <summary> Bucket a latency falls into. </summary>
+    static uint32_t ToBucket(uint64_t latencyNs)
+    {
+        // The smallest bucket whose upper bound is >= latencyNs: the bit length of (latencyNs - 1) / 1000.
+        uint64_t microseconds = latencyNs > 0 ? (latencyNs - 1) / 1000 : 0;
+        uint32_t bucket = 0;
+        while (microseconds != 0 && bucket < BucketCount - 1) {
+            microseconds >>= 1;
+            ++bucket;
+        }
+        return bucket;
+    }
+
+    /// <summary> Inclusive upper bound of a bucket, in nanoseconds. </summary>
+    static uint64_t GetBucketUpperBoundNs(uint32_t bucket)
+    {
+        return (static_cast<uint64_t>(1) << bucket) * 1000;
+    }
+
+    /// <summary> Add a single latency. </summary>
+    void Record(uint64_t latencyNs)
+    {
+        Buckets[ToBucket(latencyNs)].fetch_add(1, std::memory_order_relaxed);
+        Count.fetch_add(1, std::memory_order_relaxed);
+        SumNs.fetch_add(latencyNs, std::memory_order_relaxed);
+        uint64_t max = MaxNs.load(std::memory_order_relaxed);
+        while (latencyNs > max && !MaxNs.compare_exchange_weak(max, latencyNs, std::memory_order_relaxed)) {
+        }
+    }
+
+    /// <summary> Remove all recorded latencies. </summary>
+    void Reset()
+    {
+        for (std::atomic<uint64_t>& bucket : Buckets) {
+            bucket.store(0, std::memory_order_relaxed);
+        }
+        Count.store(0, std::memory_order_relaxed);
+        SumNs.store(0, std::memory_order_relaxed);
+        MaxNs.store(0, std::memory_order_relaxed);
+    }
+
+    /// <summary> Amount of recorded latencies. </summary>
+    SG_NODISCARD uint64_t GetCount() const
+    {
+        return Count.load(std::memory_order_relaxed);
+    }
+
+    /// <summary> Amount of recorded latencies in a bucket. </summary>
+    SG_NODISCARD uint64_t GetBucketCount(uint32_t bucket) const
+    {
+        return bucket < BucketCount ? Buckets[bucket].load(std::memory_order_relaxed) : 0;
+    }
+
+    /// <summary> Average recorded latency, in nanoseconds. </summary>
+    SG_NODISCARD uint64_t GetMeanNs() const
+    {
+        const uint64_t count = GetCount();
+        return count > 0 ? GetSumNs() / count : 0;
+    }
+
+    /// <summary> Sum of all recorded latencies, in nanoseconds. </summary>
+    SG_NODISCARD uint64_t GetSumNs() const
+    {
+        return SumNs.load(std::memory_order_relaxed);
+    }
+
+    /// <summary> Longest recorded latency, in nanoseconds. </summary>
+    SG_NODISCARD uint64_t GetMaxNs() const
+    {
+        return MaxNs.load(std::memory_order_relaxed);
+    }
+
+    /// <summary> Upper bound of the bucket containing the given percentile [0..1] of recorded latencies, in
+    /// nanoseconds, capped at the maximum. 0 if nothing was recorded. </summary>
+    SG_NODISCARD uint64_t GetPercentileNs(float percentile) const
+    {
+        uint64_t total = 0;
+        uint64_t counts[BucketCount];
+        for (uint32_t i = 0; i < BucketCount; ++i) {
+            counts[i] = Buckets[i].load(std::memory_order_relaxed);
+            total += counts[i];
+        }
+        if (total == 0) {
+            return 0;
+        }
+        const float clamped = percentile < 0.0f ? 0.0f : (percentile > 1.0f ? 1.0f : percentile);
+        const uint64_t rank = static_cast<uint64_t>(clamped * static_cast<float>(total - 1)) + 1;
+        uint64_t seen = 0;
+        for (uint32_t i = 0; i < BucketCount; ++i) {
+            seen += counts[i];
+            if (seen >= rank) {
+                const uint64_t bound = GetBucketUpperBoundNs(i);
+                const uint64_t max = GetMaxNs();
+                return bound < max ? bound : max;
+            }
+        }
+        return GetMaxNs();
+    }
+};
+
+/// <summary> Latency histograms for every stage of a single device's pipeline. </summary>
+/// <remarks> The histogram of a stage holds the time since the closest earlier stage that was timestamped, so the
+/// stages add up to the total. The Receive stage has no earlier stage, and its histogram stays empty. Record may be
+/// called from any thread. </remarks>
+class SGCore::Util::PipelineLatencyStats
+{
+private:
+    LatencyHistogram Stages[PipelineTimestamps::StageCount];
+    LatencyHistogram Total;
+
+public:
+    PipelineLatencyStats() = default;
+
+    PipelineLatencyStats(const PipelineLatencyStats& rhs) = delete;
+
+    ~PipelineLatencyStats() = default;
+
+public:
+    PipelineLatencyStats& operator=(const PipelineLatencyStats& rhs) = delete;
+
+public:
+    /// <summary> Add the latencies of a single sample. </summary>
+    void Record(const PipelineTimestamps& timestamps)
+    {
+        uint64_t previous = 0;
+        uint64_t first = 0;
+        for (uint32_t i = 0; i < PipelineTimestamps::StageCount; ++i) {
+            const uint64_t stamp = timestamps.StageNs[i];
+            if (stamp == 0) {
+                continue;
+            }
+            if (previous != 0 && stamp >= previous) {
+                Stages[i].Record(stamp - previous);
+            }
+            if (first == 0) {
+                first = stamp;
+            }
+            previous = stamp;
+        }
+        if (first != 0 && previous > first) {
+            Total.Record(previous - first);
+        }
+    }
+
+    /// <summary> Time spent reaching a stage from the stage before it. </summary>
+    SG_NODISCARD const LatencyHistogram& GetStageHistogram(ELatencyStage stage) const
+    {
+        return Stages[static_cast<uint32_t>(stage)];
+    }
+
+    /// <summary> Time from the earliest to the latest timestamp of each sample. </summary>
+    SG_NODISCARD const LatencyHistogram& GetTotalHistogram() const
+    {
+        return Total;
+    }
+
+    /// <summary> Remove all recorded latencies. </summary>
+    void Reset()
+    {
+        for (LatencyHistogram& stage : Stages) {
+            stage.Reset();
+        }
+        Total.Reset();
+    }
+};
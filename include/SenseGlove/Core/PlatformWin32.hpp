@@ -0,0 +1,77 @@
+/**
+ * @file
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2026 SenseGlove
+ *
+ * @section DESCRIPTION
+ *
+ * The handful of Win32 functions used by the header-only utilities, declared
+ * with the exact types of the Windows SDK. Avoids including <Windows.h> (and
+ * its macros, such as min / max) into every translation unit that includes a
+ * public SGCore header. Does not define any macros itself.
+ */
+
+
+#pragma once
+
+#include "Platform.hpp"
+
+#if SG_PLATFORM_WINDOWS
+
+// Identical to the declarations in the Windows SDK, so both may be visible in the same translation unit.
+struct _SECURITY_ATTRIBUTES;
+
+extern "C"
+{
+    __declspec(dllimport) void* __stdcall CreateFileMappingA(void* hFile, _SECURITY_ATTRIBUTES* lpAttributes,
+                                                             unsigned long flProtect, unsigned long dwMaximumSizeHigh,
+                                                             unsigned long dwMaximumSizeLow, const char* lpName);
+    __declspec(dllimport) void* __stdcall OpenFileMappingA(unsigned long dwDesiredAccess, int bInheritHandle,
+                                                           const char* lpName);
+#if defined ( _WIN64 )
+    __declspec(dllimport) void* __stdcall MapViewOfFile(void* hFileMappingObject, unsigned long dwDesiredAccess,
+                                                        unsigned long dwFileOffsetHigh, unsigned long dwFileOffsetLow,
+                                                        unsigned long long dwNumberOfBytesToMap);
+    __declspec(dllimport) unsigned long long __stdcall SetThreadAffinityMask(void* hThread,
+                                                                             unsigned long long dwThreadAffinityMask);
+#else   /* defined ( _WIN64 ) */
+    __declspec(dllimport) void* __stdcall MapViewOfFile(void* hFileMappingObject, unsigned long dwDesiredAccess,
+                                                        unsigned long dwFileOffsetHigh, unsigned long dwFileOffsetLow,
+                                                        unsigned long dwNumberOfBytesToMap);
+    __declspec(dllimport) unsigned long __stdcall SetThreadAffinityMask(void* hThread,
+                                                                        unsigned long dwThreadAffinityMask);
+#endif  /* defined ( _WIN64 ) */
+    __declspec(dllimport) int __stdcall UnmapViewOfFile(const void* lpBaseAddress);
+    __declspec(dllimport) int __stdcall CloseHandle(void* hObject);
+    __declspec(dllimport) unsigned long __stdcall GetLastError();
+    __declspec(dllimport) void* __stdcall GetCurrentThread();
+    __declspec(dllimport) int __stdcall SetThreadPriority(void* hThread, int nPriority);
+}
+
+namespace SGCore
+{
+    namespace Util
+    {
+        /// <summary> Win32 constants used with the functions above, with the values of the Windows SDK. </summary>
+        namespace Win32
+        {
+#if defined ( _WIN64 )
+            /// <summary> ULONG_PTR / SIZE_T / DWORD_PTR. </summary>
+            using ULongPtr = unsigned long long;
+#else   /* defined ( _WIN64 ) */
+            using ULongPtr = unsigned long;
+#endif  /* defined ( _WIN64 ) */
+
+            static void* const InvalidHandleValue = reinterpret_cast<void*>(static_cast<ULongPtr>(-1));
+            static constexpr unsigned long PageReadWrite = 0x04;
+            static constexpr unsigned long FileMapAllAccess = 0xF001F;
+            static constexpr unsigned long ErrorAlreadyExists = 183;
+            static constexpr int ThreadPriorityHighest = 2;
+            static constexpr int ThreadPriorityTimeCritical = 15;
+        }// namespace Win32
+    }// namespace Util
+}// namespace SGCore
+
+#endif  /* SG_PLATFORM_WINDOWS */
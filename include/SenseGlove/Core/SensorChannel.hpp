@@ -0,0 +1,331 @@
+/**
+ * @file
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2026 SenseGlove
+ *
+ * @section DESCRIPTION
+ *
+ * Binary alternative to SharedMem::ReadFrom for sensor data. Each device gets
+ * its own shared memory block holding the latest SensorFrame, guarded by a
+ * sequence lock so that readers never block the writer and never allocate.
+ * Readers may also sleep until the writer publishes a new frame.
+ */
+
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <climits>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <string>
+#include <utility>
+
+#include "Platform.hpp"
+#include "SensorFrame.hpp"
+#include "SharedMemoryRegion.hpp"
+
+#if SG_PLATFORM_LINUX && !SG_PLATFORM_ANDROID
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+#define SG_SENSORCHANNEL_FUTEX 1
+#else   /* SG_PLATFORM_LINUX && !SG_PLATFORM_ANDROID */
+#include <thread>
+#define SG_SENSORCHANNEL_FUTEX 0
+#endif  /* SG_PLATFORM_LINUX && !SG_PLATFORM_ANDROID */
+
+namespace SGCore
+{
+    namespace Util
+    {
+        /// <summary> Binary, per-device shared memory block containing the latest SensorFrame. </summary>
+        class SensorChannel;
+    }// namespace Util
+}// namespace SGCore
+
+/// <summary> Binary, per-device shared memory block containing the latest SensorFrame. </summary>
+/// <remarks> There should be exactly one writer per device (SGConnect, or a stand-in such as a simulation), but any
+/// number of readers. Readers copy the frame out and validate it against the sequence lock, retrying if the writer
+/// was busy. </remarks>
+class SGCore::Util::SensorChannel
+{
+public:
+    /// <summary> Name of the shared memory block for a specific device index. </summary>
+    SG_NODISCARD static std::string GetBlockName(int32_t deviceIndex)
+    {
+        return "SG_SensorFrames_" + std::to_string(deviceIndex);
+    }
+
+    /// <summary> Identifies a properly initialized block ("SGSF"). </summary>
+    static constexpr uint32_t GetMagic()
+    {
+        return 0x46534753u;
+    }
+
+    /// <summary> How many times a reader retries when the writer is publishing, before giving up. </summary>
+    static constexpr int32_t GetMaxReadAttempts()
+    {
+        return 64;
+    }
+
+private:
+    /// <summary> Layout of the shared memory block. </summary>
+    struct Block
+    {
+        uint32_t Magic;
+        uint32_t FrameVersion;
+        std::atomic<uint32_t> SeqLock;// odd while the writer is busy. Doubles as the futex word.
+        std::atomic<uint32_t> Waiters;// readers currently sleeping in WaitForNewData.
+        SensorFrame Frame;
+    };
+
+    static_assert(ATOMIC_INT_LOCK_FREE == 2, "SensorChannel requires address-free atomics for shared memory.");
+
+private:
+    SharedMemoryRegion Region;
+    Block* Shared = nullptr;
+    bool bWriter = false;
+    uint64_t NextSequence = 1;
+
+public:
+    SensorChannel() = default;
+
+    SensorChannel(const SensorChannel& rhs) = delete;
+
+    SensorChannel(SensorChannel&& rhs) noexcept
+        : Region(std::move(rhs.Region)), Shared(rhs.Shared), bWriter(rhs.bWriter), NextSequence(rhs.NextSequence)
+    {
+        rhs.Shared = nullptr;
+        rhs.bWriter = false;
+    }
+
+    ~SensorChannel() = default;
+
+public:
+    SensorChannel& operator=(const SensorChannel& rhs) = delete;
+
+    SensorChannel& operator=(SensorChannel&& rhs) noexcept
+    {
+        if (this != &rhs) {
+            Region = std::move(rhs.Region);
+            Shared = rhs.Shared;
+            bWriter = rhs.bWriter;
+            NextSequence = rhs.NextSequence;
+            rhs.Shared = nullptr;
+            rhs.bWriter = false;
+        }
+        return *this;
+    }
+
+public:
+    //--------------------------------------------------------------------------------------
+    // Opening / Closing
+
+    /// <summary> Attach to an existing block as a reader. Returns false if no writer has created it yet, or if it
+    /// was created with a different SensorFrame layout. </summary>
+    bool OpenReader(int32_t deviceIndex)
+    {
+        Close();
+        // Map the header first; a block written with another frame layout has a different size.
+        if (!Region.Open(GetBlockName(deviceIndex), sizeof(uint32_t) * 2, false)) {
+            return false;
+        }
+        const uint32_t* probe = static_cast<const uint32_t*>(Region.GetData());
+        if (probe[0] != GetMagic() || probe[1] != SensorFrame::GetLayoutVersion()) {
+            Region.Close();
+            return false;
+        }
+        if (!Region.Open(GetBlockName(deviceIndex), sizeof(Block), false)) {
+            return false;
+        }
+        Shared = static_cast<Block*>(Region.GetData());
+        return true;
+    }
+
+    /// <summary> Create (or re-attach to) the block for a device as its writer. </summary>
+    bool OpenWriter(int32_t deviceIndex)
+    {
+        Close();
+        if (!Region.Open(GetBlockName(deviceIndex), sizeof(Block), true)) {
+            return false;
+        }
+        Shared = static_cast<Block*>(Region.GetData());
+        bWriter = true;
+        if (Region.WasCreated() || Shared->Magic != GetMagic()
+            || Shared->FrameVersion != SensorFrame::GetLayoutVersion()) {
+            new(Shared) Block();
+            Shared->Frame.Clear();
+            Shared->FrameVersion = SensorFrame::GetLayoutVersion();
+            std::atomic_thread_fence(std::memory_order_release);
+            Shared->Magic = GetMagic();
+            NextSequence = 1;
+        } else {
+            NextSequence = Shared->Frame.Sequence + 1;// writer restarted; keep counting.
+        }
+        return true;
+    }
+
+    /// <summary> Detach from the shared memory block. </summary>
+    void Close()
+    {
+        Region.Close();
+        Shared = nullptr;
+        bWriter = false;
+    }
+
+    /// <summary> Returns true if this channel is attached to a valid block. </summary>
+    SG_NODISCARD bool IsOpen() const
+    {
+        return Shared != nullptr && Shared->Magic == GetMagic();
+    }
+
+    //--------------------------------------------------------------------------------------
+    // Writing
+
+    /// <summary> Publish a new frame. Sequence, LayoutVersion and PublishTimestampNs are assigned here; TimestampNs
+    /// is filled in if it was left at 0. Returns false if this channel was not opened as a writer. </summary>
+    bool Publish(SensorFrame& frame)
+    {
+        if (!bWriter || Shared == nullptr) {
+            return false;
+        }
+        frame.LayoutVersion = SensorFrame::GetLayoutVersion();
+        frame.Sequence = NextSequence++;
+        frame.PublishTimestampNs = SensorFrame::NowNanoseconds();
+        if (frame.TimestampNs == 0) {
+            frame.TimestampNs = frame.PublishTimestampNs;
+        }
+        const uint32_t seq = Shared->SeqLock.load(std::memory_order_relaxed);
+        Shared->SeqLock.store(seq + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        std::memcpy(&Shared->Frame, &frame, sizeof(SensorFrame));
+        Shared->SeqLock.store(seq + 2, std::memory_order_seq_cst);// pairs with the Waiters check below.
+        if (Shared->Waiters.load(std::memory_order_seq_cst) != 0) {
+            WakeWaiters();
+        }
+        return true;
+    }
+
+private:
+    void WakeWaiters()
+    {
+#if SG_SENSORCHANNEL_FUTEX
+        ::syscall(SYS_futex, reinterpret_cast<uint32_t*>(&Shared->SeqLock), FUTEX_WAKE, INT_MAX, nullptr, nullptr, 0);
+#endif  /* SG_SENSORCHANNEL_FUTEX */
+    }
+
+public:
+    //--------------------------------------------------------------------------------------
+    // Reading
+
+    /// <summary> Copy the latest frame into out_frame. Does not allocate. Returns false if the channel is closed,
+    /// nothing has been published yet, or the writer kept us out for GetMaxReadAttempts() tries. </summary>
+    bool TryRead(SensorFrame& out_frame) const
+    {
+        if (!IsOpen()) {
+            return false;
+        }
+        for (int32_t attempt = 0; attempt < GetMaxReadAttempts(); ++attempt) {
+            const uint32_t before = Shared->SeqLock.load(std::memory_order_acquire);
+            if ((before & 1u) != 0) {
+                continue;// writer is busy.
+            }
+            std::memcpy(&out_frame, &Shared->Frame, sizeof(SensorFrame));
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (Shared->SeqLock.load(std::memory_order_relaxed) == before) {
+                return out_frame.IsValid();
+            }
+        }
+        return false;
+    }
+
+    /// <summary> Copy the latest frame into out_frame only if it is newer than lastSequence. </summary>
+    bool TryReadNew(uint64_t lastSequence, SensorFrame& out_frame) const
+    {
+        return GetLatestSequence() > lastSequence && TryRead(out_frame) && out_frame.Sequence > lastSequence;
+    }
+
+    /// <summary> Sequence number of the most recently published frame, or 0 if there is none. </summary>
+    /// <remarks> A cheap check to skip TryRead when nothing changed; only the sequence number is copied. </remarks>
+    SG_NODISCARD uint64_t GetLatestSequence() const
+    {
+        if (!IsOpen()) {
+            return 0;
+        }
+        for (int32_t attempt = 0; attempt < GetMaxReadAttempts(); ++attempt) {
+            const uint32_t before = Shared->SeqLock.load(std::memory_order_acquire);
+            if ((before & 1u) != 0) {
+                continue;
+            }
+            uint64_t sequence = 0;
+            std::memcpy(&sequence, &Shared->Frame.Sequence, sizeof(uint64_t));
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (Shared->SeqLock.load(std::memory_order_relaxed) == before) {
+                return sequence;
+            }
+        }
+        return 0;
+    }
+
+    //--------------------------------------------------------------------------------------
+    // Waiting
+
+    /// <summary> Block the calling thread until a frame newer than lastSequence is published, or until timeout
+    /// passes. Returns true if new data is available. </summary>
+    /// <remarks> A timeout too large to represent as a deadline, e.g. microseconds::max(), waits without limit.
+    /// On Linux, the thread sleeps on a futex in the shared memory block and is woken by Publish(), so
+    /// there is no polling latency. Other platforms fall back to polling with a short, backing-off sleep. </remarks>
+    bool WaitForNewData(uint64_t lastSequence, std::chrono::microseconds timeout)
+    {
+        if (!IsOpen()) {
+            return false;
+        }
+        // Saturate rather than overflow, so a timeout such as microseconds::max() waits indefinitely.
+        const std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+        const std::chrono::microseconds headroom =
+            std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::time_point::max() - now);
+        const std::chrono::steady_clock::time_point deadline =
+            timeout < headroom ? now + timeout : std::chrono::steady_clock::time_point::max();
+#if SG_SENSORCHANNEL_FUTEX
+        while (true) {
+            Shared->Waiters.fetch_add(1, std::memory_order_seq_cst);
+            const uint32_t seq = Shared->SeqLock.load(std::memory_order_seq_cst);
+            if (GetLatestSequence() > lastSequence) {
+                Shared->Waiters.fetch_sub(1, std::memory_order_relaxed);
+                return true;
+            }
+            const std::chrono::steady_clock::duration remaining = deadline - std::chrono::steady_clock::now();
+            if (remaining <= std::chrono::steady_clock::duration::zero()) {
+                Shared->Waiters.fetch_sub(1, std::memory_order_relaxed);
+                return false;
+            }
+            const long long remainingNs = std::chrono::duration_cast<std::chrono::nanoseconds>(remaining).count();
+            struct timespec relative{};
+            relative.tv_sec = static_cast<time_t>(remainingNs / 1000000000LL);
+            relative.tv_nsec = static_cast<long>(remainingNs % 1000000000LL);
+            // Returns immediately if SeqLock no longer equals seq, i.e. the writer got there first.
+            ::syscall(SYS_futex, reinterpret_cast<uint32_t*>(&Shared->SeqLock), FUTEX_WAIT, seq, &relative,
+                      nullptr, 0);
+            Shared->Waiters.fetch_sub(1, std::memory_order_relaxed);
+        }
+#else   /* SG_SENSORCHANNEL_FUTEX */
+        std::chrono::microseconds backoff(10);
+        while (GetLatestSequence() <= lastSequence) {
+            if (std::chrono::steady_clock::now() >= deadline) {
+                return false;
+            }
+            std::this_thread::sleep_for(backoff);
+            if (backoff < std::chrono::microseconds(500)) {
+                backoff *= 2;
+            }
+        }
+        return true;
+#endif  /* SG_SENSORCHANNEL_FUTEX */
+    }
+};
\ No newline at end of file
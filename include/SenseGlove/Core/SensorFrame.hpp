@@ -0,0 +1,159 @@
+/**
+ * @file
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2026 SenseGlove
+ *
+ * @section DESCRIPTION
+ *
+ * A fixed-layout, binary sensor sample as it is placed in shared memory.
+ * Contains no pointers or std:: containers, so it can be copied between
+ * processes with a plain memcpy, and read without any allocations.
+ */
+
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#include "DeviceTypes.hpp"
+#include "PipelineLatency.hpp"
+#include "Platform.hpp"
+
+namespace SGCore
+{
+    namespace Util
+    {
+        /// <summary> A single, fixed-layout binary sensor sample. </summary>
+        struct SensorFrame;
+    }// namespace Util
+}// namespace SGCore
+
+/// <summary> A single, fixed-layout binary sensor sample. </summary>
+/// <remarks> Layout is versioned through GetLayoutVersion(). Fields may only ever be appended, and the version must
+/// be bumped when they are. All multi-byte values are stored in the native byte order of the host. </remarks>
+struct SGCore::Util::SensorFrame
+{
+public:
+    /// <summary> Maximum amount of raw sensor values a single frame can hold. Enough for a Nova 2.0 (5 fingers,
+    /// 3 movements each) or a SenseGlove DK1 (5 fingers, 4 sensors each). </summary>
+    static constexpr uint32_t MaxSensorValues = 32;
+
+    /// <summary> Current layout version of this struct. </summary>
+    static constexpr uint32_t GetLayoutVersion()
+    {
+        return 2;
+    }
+
+    /// <summary> Monotonic clock used for all frame timestamps, in nanoseconds. </summary>
+    /// <remarks> steady_clock is system-wide on all of our platforms, so timestamps from SGConnect and SGCore can be
+    /// compared directly. </remarks>
+    static uint64_t NowNanoseconds()
+    {
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now().time_since_epoch()).count());
+    }
+
+public:
+    /// <summary> Layout version this frame was written with. 0 means no frame has been written yet. </summary>
+    uint32_t LayoutVersion;
+
+    /// <summary> Which device type produced this sample, as an EDeviceType. </summary>
+    int8_t DeviceType;
+
+    /// <summary> Amount of valid entries in Values. </summary>
+    uint8_t ValueCount;
+
+    /// <summary> Bit flags; see the Flag_ constants. </summary>
+    uint16_t Flags;
+
+    /// <summary> Increases by one for every sample published by a device. Used to detect new (or missed) samples.
+    /// </summary>
+    uint64_t Sequence;
+
+    /// <summary> Time at which the sample was received from the device, in NowNanoseconds(). </summary>
+    uint64_t TimestampNs;
+
+    /// <summary> Raw sensor values, in the same order as the device's string protocol. </summary>
+    float Values[MaxSensorValues];
+
+    /// <summary> IMU rotation as x, y, z, w. Only valid if Flag_ImuValid is set. </summary>
+    float Imu[4];
+
+    /// <summary> Battery level [0..1], or -1 if unknown. </summary>
+    float BatteryLevel;
+
+    /// <summary> Explicit padding, keeps the layout identical across compilers. Always 0. </summary>
+    uint32_t Reserved;
+
+    /// <summary> Time at which the sample was published to shared memory, in NowNanoseconds(). Added in layout
+    /// version 2. </summary>
+    uint64_t PublishTimestampNs;
+
+public:
+    /// <summary> The Imu field contains a valid rotation. </summary>
+    static constexpr uint16_t Flag_ImuValid = 1 << 0;
+
+    /// <summary> The device is connected to a power source. </summary>
+    static constexpr uint16_t Flag_Charging = 1 << 1;
+
+    /// <summary> Values were normalized on-board the device. </summary>
+    static constexpr uint16_t Flag_Normalized = 1 << 2;
+
+public:
+    /// <summary> Reset this frame to an empty state, without any sensor values. </summary>
+    void Clear()
+    {
+        std::memset(this, 0, sizeof(SensorFrame));
+        DeviceType = static_cast<int8_t>(EDeviceType::Unknown);
+        Imu[3] = 1.0f;
+        BatteryLevel = -1.0f;
+    }
+
+    /// <summary> Copy a set of raw sensor values into this frame. Values beyond MaxSensorValues are dropped.
+    /// </summary>
+    void SetValues(const float* values, uint32_t count)
+    {
+        const uint32_t maxValues = MaxSensorValues;
+        const uint32_t toCopy = count < maxValues ? count : maxValues;
+        std::memcpy(Values, values, toCopy * sizeof(float));
+        ValueCount = static_cast<uint8_t>(toCopy);
+    }
+
+    /// <summary> Returns true if this frame was written with a layout we understand. </summary>
+    SG_NODISCARD bool IsValid() const
+    {
+        return LayoutVersion != 0 && LayoutVersion <= GetLayoutVersion() && ValueCount <= MaxSensorValues;
+    }
+
+    /// <summary> Returns true if a specific flag is set. </summary>
+    SG_NODISCARD bool HasFlag(uint16_t flag) const
+    {
+        return (Flags & flag) != 0;
+    }
+
+    /// <summary> The device type that produced this frame. </summary>
+    SG_NODISCARD EDeviceType GetDeviceType() const
+    {
+        return static_cast<EDeviceType>(DeviceType);
+    }
+
+    /// <summary> Copy the Receive and Publish timestamps of this frame into out_timestamps. Other stages are left
+    /// untouched. </summary>
+    void GetTimestamps(PipelineTimestamps& out_timestamps) const
+    {
+        out_timestamps.Set(ELatencyStage::Receive, TimestampNs);
+        out_timestamps.Set(ELatencyStage::Publish, PublishTimestampNs);
+    }
+};
+
+static_assert(std::is_trivially_copyable<SGCore::Util::SensorFrame>::value,
+              "SensorFrame is copied through shared memory and must remain trivially copyable.");
+static_assert(std::is_standard_layout<SGCore::Util::SensorFrame>::value,
+              "SensorFrame is shared between processes and must remain standard layout.");
+static_assert(sizeof(SGCore::Util::SensorFrame) == 184,
+              "SensorFrame layout changed; bump GetLayoutVersion() and update this check.");
\ No newline at end of file
@@ -0,0 +1,280 @@
+/**
+ * @file
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2026 SenseGlove
+ *
+ * @section DESCRIPTION
+ *
+ * A lock-free single-producer / single-consumer ring of SensorFrames in shared
+ * memory, one per device. Where SensorChannel only ever holds the latest
+ * sample, this ring keeps every sample until the consumer drains it.
+ */
+
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "Platform.hpp"
+#include "SensorFrame.hpp"
+#include "SharedMemoryRegion.hpp"
+
+namespace SGCore
+{
+    namespace Util
+    {
+        /// <summary> Lock-free SPSC ring of SensorFrames in shared memory. </summary>
+        class SensorFrameRing;
+    }// namespace Util
+}// namespace SGCore
+
+/// <summary> Lock-free SPSC ring of SensorFrames in shared memory. </summary>
+/// <remarks> Exactly one producer (SGConnect, or a stand-in) and one consumer per device. The producer never waits:
+/// if the consumer falls a full ring behind, new frames are dropped and counted in GetDroppedFrames(). Gaps are also
+/// visible to the consumer through SensorFrame::Sequence. </remarks>
+class SGCore::Util::SensorFrameRing
+{
+public:
+    /// <summary> Name of the shared memory block for a specific device index. </summary>
+    SG_NODISCARD static std::string GetBlockName(int32_t deviceIndex)
+    {
+        return "SG_SensorRing_" + std::to_string(deviceIndex);
+    }
+
+    /// <summary> Identifies a properly initialized block ("SGSR"). </summary>
+    static constexpr uint32_t GetMagic()
+    {
+        return 0x52534753u;
+    }
+
+    /// <summary> Default amount of frames in a ring: a bit over a second at 2 kHz. Must be a power of two. </summary>
+    static constexpr uint32_t GetDefaultCapacity()
+    {
+        return 4096;
+    }
+
+private:
+    /// <summary> Header of the shared memory block. The frames follow directly after it. </summary>
+    struct Header
+    {
+        uint32_t Magic;
+        uint32_t FrameVersion;
+        uint32_t Capacity;
+        uint32_t Reserved;
+
+        /// <summary> Total frames written. Only modified by the producer. </summary>
+        alignas(64) std::atomic<uint32_t> Head;
+
+        /// <summary> Total frames consumed. Only modified by the consumer. </summary>
+        alignas(64) std::atomic<uint32_t> Tail;
+
+        /// <summary> Frames the producer had to drop because the ring was full. </summary>
+        alignas(64) std::atomic<uint32_t> Dropped;
+    };
+
+    static_assert(ATOMIC_INT_LOCK_FREE == 2, "SensorFrameRing requires address-free atomics for shared memory.");
+
+    static SG_FORCEINLINE std::size_t BlockSize(uint32_t capacity)
+    {
+        return sizeof(Header) + static_cast<std::size_t>(capacity) * sizeof(SensorFrame);
+    }
+
+    static SG_FORCEINLINE bool IsPowerOfTwo(uint32_t value)
+    {
+        return value != 0 && (value & (value - 1)) == 0;
+    }
+
+private:
+    SharedMemoryRegion Region;
+    Header* Shared = nullptr;
+    SensorFrame* Frames = nullptr;
+    uint32_t Mask = 0;
+
+public:
+    SensorFrameRing() = default;
+
+    SensorFrameRing(const SensorFrameRing& rhs) = delete;
+
+    SensorFrameRing(SensorFrameRing&& rhs) noexcept
+        : Region(std::move(rhs.Region)), Shared(rhs.Shared), Frames(rhs.Frames), Mask(rhs.Mask)
+    {
+        rhs.Shared = nullptr;
+        rhs.Frames = nullptr;
+        rhs.Mask = 0;
+    }
+
+    ~SensorFrameRing() = default;
+
+public:
+    SensorFrameRing& operator=(const SensorFrameRing& rhs) = delete;
+
+    SensorFrameRing& operator=(SensorFrameRing&& rhs) noexcept
+    {
+        if (this != &rhs) {
+            Region = std::move(rhs.Region);
+            Shared = rhs.Shared;
+            Frames = rhs.Frames;
+            Mask = rhs.Mask;
+            rhs.Shared = nullptr;
+            rhs.Frames = nullptr;
+            rhs.Mask = 0;
+        }
+        return *this;
+    }
+
+public:
+    //--------------------------------------------------------------------------------------
+    // Opening / Closing
+
+    /// <summary> Create (or re-attach to) the ring of a device as its producer. Capacity must be a power of two. A
+    /// block left over with another capacity or frame layout is re-initialized. </summary>
+    bool OpenProducer(int32_t deviceIndex, uint32_t capacity = GetDefaultCapacity())
+    {
+        Close();
+        if (!IsPowerOfTwo(capacity) || !Region.Open(GetBlockName(deviceIndex), BlockSize(capacity), true)) {
+            return false;
+        }
+        Header* header = static_cast<Header*>(Region.GetData());
+        if (Region.WasCreated() || header->Magic != GetMagic() || header->Capacity != capacity
+            || header->FrameVersion != SensorFrame::GetLayoutVersion()) {
+            new(header) Header();
+            header->FrameVersion = SensorFrame::GetLayoutVersion();
+            header->Capacity = capacity;
+            std::atomic_thread_fence(std::memory_order_release);
+            header->Magic = GetMagic();
+        }
+        Attach(header);
+        return true;
+    }
+
+    /// <summary> Attach to the ring of a device as its consumer. Returns false if no producer has created it yet.
+    /// Frames already in the ring are skipped, so the first Drain only returns frames published after this call.
+    /// </summary>
+    bool OpenConsumer(int32_t deviceIndex)
+    {
+        Close();
+        // Map the header first to learn the capacity, then remap the whole block.
+        if (!Region.Open(GetBlockName(deviceIndex), sizeof(Header), false)) {
+            return false;
+        }
+        const Header* probe = static_cast<const Header*>(Region.GetData());
+        if (probe->Magic != GetMagic() || probe->FrameVersion != SensorFrame::GetLayoutVersion()
+            || !IsPowerOfTwo(probe->Capacity)) {
+            Region.Close();
+            return false;
+        }
+        const uint32_t capacity = probe->Capacity;
+        if (!Region.Open(GetBlockName(deviceIndex), BlockSize(capacity), false)) {
+            return false;
+        }
+        Attach(static_cast<Header*>(Region.GetData()));
+        Shared->Tail.store(Shared->Head.load(std::memory_order_acquire), std::memory_order_release);
+        return true;
+    }
+
+    /// <summary> Detach from the shared memory block. </summary>
+    void Close()
+    {
+        Region.Close();
+        Shared = nullptr;
+        Frames = nullptr;
+        Mask = 0;
+    }
+
+    /// <summary> Returns true if this ring is attached to a valid block. </summary>
+    SG_NODISCARD bool IsOpen() const
+    {
+        return Shared != nullptr;
+    }
+
+private:
+    void Attach(Header* header)
+    {
+        Shared = header;
+        Frames = reinterpret_cast<SensorFrame*>(reinterpret_cast<unsigned char*>(header) + sizeof(Header));
+        Mask = header->Capacity - 1;
+    }
+
+public:
+    //--------------------------------------------------------------------------------------
+    // Producer
+
+    /// <summary> Append a frame to the ring. PublishTimestampNs of the copy in the ring is assigned here, as
+    /// SensorChannel::Publish does, so frames that are pushed again (e.g. replayed) never keep an old stamp. Returns
+    /// false (and counts a dropped frame) if the ring is full. </summary>
+    bool Push(const SensorFrame& frame)
+    {
+        if (Shared == nullptr) {
+            return false;
+        }
+        const uint32_t head = Shared->Head.load(std::memory_order_relaxed);
+        const uint32_t tail = Shared->Tail.load(std::memory_order_acquire);
+        if (head - tail > Mask) {
+            Shared->Dropped.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        SensorFrame& slot = Frames[head & Mask];
+        std::memcpy(&slot, &frame, sizeof(SensorFrame));
+        slot.PublishTimestampNs = SensorFrame::NowNanoseconds();
+        Shared->Head.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    //--------------------------------------------------------------------------------------
+    // Consumer
+
+    /// <summary> Replace the contents of out_frames with every frame published since the last call, oldest first.
+    /// Returns the amount of frames drained. </summary>
+    /// <remarks> Lock-free. Only allocates when out_frames has to grow, so re-using the same vector every frame
+    /// keeps this allocation-free after the first few calls. </remarks>
+    std::size_t Drain(std::vector<SensorFrame>& out_frames)
+    {
+        out_frames.clear();
+        if (Shared == nullptr) {
+            return 0;
+        }
+        const uint32_t tail = Shared->Tail.load(std::memory_order_relaxed);
+        const uint32_t head = Shared->Head.load(std::memory_order_acquire);
+        const uint32_t available = head - tail;
+        if (available == 0) {
+            return 0;
+        }
+        out_frames.resize(available);
+        const uint32_t first = tail & Mask;
+        const uint32_t firstChunk = (Mask + 1) - first < available ? (Mask + 1) - first : available;
+        std::memcpy(out_frames.data(), &Frames[first], firstChunk * sizeof(SensorFrame));
+        if (firstChunk < available) {
+            std::memcpy(out_frames.data() + firstChunk, &Frames[0], (available - firstChunk) * sizeof(SensorFrame));
+        }
+        Shared->Tail.store(head, std::memory_order_release);
+        return available;
+    }
+
+    /// <summary> Amount of frames waiting to be drained. </summary>
+    SG_NODISCARD uint32_t GetPendingFrames() const
+    {
+        return Shared != nullptr
+               ? Shared->Head.load(std::memory_order_acquire) - Shared->Tail.load(std::memory_order_acquire)
+               : 0;
+    }
+
+    /// <summary> Amount of frames the producer has dropped because this ring was full. </summary>
+    SG_NODISCARD uint32_t GetDroppedFrames() const
+    {
+        return Shared != nullptr ? Shared->Dropped.load(std::memory_order_relaxed) : 0;
+    }
+
+    /// <summary> Maximum amount of frames this ring can hold. </summary>
+    SG_NODISCARD uint32_t GetCapacity() const
+    {
+        return Shared != nullptr ? Mask + 1 : 0;
+    }
+};
\ No newline at end of file
@@ -0,0 +1,234 @@
+/**
+ * @file
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2026 SenseGlove
+ *
+ * @section DESCRIPTION
+ *
+ * A raw, fixed-size block of named shared memory that can be mapped directly
+ * into this process. Unlike SharedMem, which exchanges strings, this region
+ * hands out a pointer so that POD records can be read and written in place.
+ */
+
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+
+#include "Platform.hpp"
+#include "PlatformWin32.hpp"
+
+#if !SG_PLATFORM_WINDOWS && !SG_PLATFORM_ANDROID
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif  /* !SG_PLATFORM_WINDOWS && !SG_PLATFORM_ANDROID */
+
+namespace SGCore
+{
+    namespace Util
+    {
+        /// <summary> A raw, fixed-size block of named shared memory, mapped into this process. </summary>
+        class SharedMemoryRegion;
+    }// namespace Util
+}// namespace SGCore
+
+/// <summary> A raw, fixed-size block of named shared memory, mapped into this process. </summary>
+/// <remarks> Android has no named shared memory outside of ASharedMemory, so Open() will always fail there; the
+/// AndroidStrings back-end remains the only option on that platform. </remarks>
+class SGCore::Util::SharedMemoryRegion
+{
+public:
+    /// <summary> Returns true if named shared memory regions can be used on this platform. </summary>
+    static SG_FORCEINLINE bool IsSupported()
+    {
+#if SG_PLATFORM_ANDROID
+        return false;
+#else   /* SG_PLATFORM_ANDROID */
+        return true;
+#endif  /* SG_PLATFORM_ANDROID */
+    }
+
+    /// <summary> Remove a named region from the system. Processes that still have it mapped keep their view.
+    /// </summary>
+    static bool Unlink(const std::string& name)
+    {
+#if SG_PLATFORM_WINDOWS || SG_PLATFORM_ANDROID
+        (void) name;
+        return true;// Windows releases the mapping once the last handle closes.
+#else   /* SG_PLATFORM_WINDOWS || SG_PLATFORM_ANDROID */
+        return ::shm_unlink(ToSystemName(name).c_str()) == 0;
+#endif  /* SG_PLATFORM_WINDOWS || SG_PLATFORM_ANDROID */
+    }
+
+private:
+    static std::string ToSystemName(const std::string& name)
+    {
+#if SG_PLATFORM_WINDOWS
+        return "Local\\" + name;
+#else   /* SG_PLATFORM_WINDOWS */
+        return "/" + name;
+#endif  /* SG_PLATFORM_WINDOWS */
+    }
+
+private:
+    void* Data = nullptr;
+    std::size_t Size = 0;
+    bool bCreated = false;
+
+#if SG_PLATFORM_WINDOWS
+    /// <summary> Handle of the file mapping object (a Win32 HANDLE). </summary>
+    void* Mapping = nullptr;
+#endif  /* SG_PLATFORM_WINDOWS */
+
+public:
+    SharedMemoryRegion() = default;
+
+    SharedMemoryRegion(const SharedMemoryRegion& rhs) = delete;
+
+    SharedMemoryRegion(SharedMemoryRegion&& rhs) noexcept
+    {
+        *this = std::move(rhs);
+    }
+
+    ~SharedMemoryRegion()
+    {
+        Close();
+    }
+
+public:
+    SharedMemoryRegion& operator=(const SharedMemoryRegion& rhs) = delete;
+
+    SharedMemoryRegion& operator=(SharedMemoryRegion&& rhs) noexcept
+    {
+        if (this != &rhs) {
+            Close();
+            Data = rhs.Data;
+            Size = rhs.Size;
+            bCreated = rhs.bCreated;
+#if SG_PLATFORM_WINDOWS
+            Mapping = rhs.Mapping;
+            rhs.Mapping = nullptr;
+#endif  /* SG_PLATFORM_WINDOWS */
+            rhs.Data = nullptr;
+            rhs.Size = 0;
+            rhs.bCreated = false;
+        }
+        return *this;
+    }
+
+public:
+    /// <summary> Map a named region of (at least) size bytes. If bCreate is true, the region is created when it
+    /// does not yet exist. A freshly created region is zero-filled. Returns true if successful. </summary>
+    bool Open(const std::string& name, std::size_t size, bool bCreate)
+    {
+        Close();
+        if (size == 0) {
+            return false;
+        }
+        const std::string systemName = ToSystemName(name);
+
+#if SG_PLATFORM_WINDOWS
+        const uint64_t size64 = static_cast<uint64_t>(size);
+        if (bCreate) {
+            Mapping = ::CreateFileMappingA(Win32::InvalidHandleValue, nullptr, Win32::PageReadWrite,
+                                           static_cast<unsigned long>(size64 >> 32),
+                                           static_cast<unsigned long>(size64 & 0xFFFFFFFFu), systemName.c_str());
+            bCreated = Mapping != nullptr && ::GetLastError() != Win32::ErrorAlreadyExists;
+        } else {
+            Mapping = ::OpenFileMappingA(Win32::FileMapAllAccess, 0, systemName.c_str());
+        }
+        if (Mapping == nullptr) {
+            return false;
+        }
+        Data = ::MapViewOfFile(Mapping, Win32::FileMapAllAccess, 0, 0, static_cast<Win32::ULongPtr>(size));
+        if (Data == nullptr) {
+            ::CloseHandle(Mapping);
+            Mapping = nullptr;
+            return false;
+        }
+        Size = size;
+        return true;
+#elif SG_PLATFORM_ANDROID
+        (void) systemName;
+        (void) bCreate;
+        return false;
+#else   /* SG_PLATFORM_WINDOWS */
+        int fd = ::shm_open(systemName.c_str(), O_RDWR | (bCreate ? O_CREAT | O_EXCL : 0), 0666);
+        if (fd < 0 && bCreate) {
+            fd = ::shm_open(systemName.c_str(), O_RDWR, 0666);// someone beat us to it.
+        } else if (fd >= 0 && bCreate) {
+            bCreated = true;
+        }
+        if (fd < 0) {
+            return false;
+        }
+        struct stat info{};
+        if (::fstat(fd, &info) != 0
+            || (static_cast<std::size_t>(info.st_size) < size && ::ftruncate(fd, static_cast<off_t>(size)) != 0)) {
+            ::close(fd);
+            return false;
+        }
+        void* mapped = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        ::close(fd);// the mapping keeps the object alive.
+        if (mapped == MAP_FAILED) {
+            return false;
+        }
+        Data = mapped;
+        Size = size;
+        return true;
+#endif  /* SG_PLATFORM_WINDOWS */
+    }
+
+    /// <summary> Unmap this region. Does not remove it from the system; see Unlink. </summary>
+    void Close()
+    {
+#if SG_PLATFORM_WINDOWS
+        if (Data != nullptr) {
+            ::UnmapViewOfFile(Data);
+        }
+        if (Mapping != nullptr) {
+            ::CloseHandle(Mapping);
+            Mapping = nullptr;
+        }
+#elif !SG_PLATFORM_ANDROID
+        if (Data != nullptr) {
+            ::munmap(Data, Size);
+        }
+#endif  /* SG_PLATFORM_WINDOWS */
+        Data = nullptr;
+        Size = 0;
+        bCreated = false;
+    }
+
+public:
+    /// <summary> Returns true if this region is currently mapped. </summary>
+    SG_NODISCARD bool IsOpen() const
+    {
+        return Data != nullptr;
+    }
+
+    /// <summary> Returns true if this process created the region during the last call to Open(). </summary>
+    SG_NODISCARD bool WasCreated() const
+    {
+        return bCreated;
+    }
+
+    /// <summary> Start of the mapped memory, or nullptr if the region is not open. </summary>
+    SG_NODISCARD void* GetData() const
+    {
+        return Data;
+    }
+
+    /// <summary> Size of the mapped memory, in bytes. </summary>
+    SG_NODISCARD std::size_t GetSize() const
+    {
+        return Size;
+    }
+};
\ No newline at end of file
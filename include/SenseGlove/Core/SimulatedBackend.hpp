@@ -0,0 +1,338 @@
+/**
+ * @file
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2026 SenseGlove
+ *
+ * @section DESCRIPTION
+ *
+ * An in-process stand-in for SGConnect. Generates sensor frames for any number
+ * of virtual Nova, Nova 2.0 and SenseGlove devices at a fixed packet rate, and
+ * publishes them to the same SensorChannel and SensorFrameRing blocks that a
+ * live back-end writes to. Intended for load testing without any hardware.
+ */
+
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "DeviceTypes.hpp"
+#include "PeriodicTimer.hpp"
+#include "Platform.hpp"
+#include "SensorChannel.hpp"
+#include "SensorFrame.hpp"
+#include "SensorFrameRing.hpp"
+
+namespace SGCore
+{
+    /// <summary> In-process stand-in for SGConnect that publishes frames of virtual devices. </summary>
+    class SimulatedBackend;
+}// namespace SGCore
+
+/// <summary> In-process stand-in for SGConnect that publishes frames of virtual devices. </summary>
+/// <remarks> Each virtual device gets a device index, and its frames are published exactly like a live back-end
+/// would: to the SensorChannel (latest frame) and SensorFrameRing (every frame) of that index. Frames come from a
+/// script (a function of the sample index), from a recording that is replayed, or from a default pattern of slowly
+/// moving fingers. Generation depends only on the sample index, so runs are reproducible. Devices must be added
+/// before Start(). </remarks>
+class SGCore::SimulatedBackend
+{
+public:
+    /// <summary> Fills out_frame for a specific sample. LayoutVersion, Sequence and the timestamps are assigned
+    /// afterwards. </summary>
+    using FrameScript = std::function<void(uint64_t sampleIndex, Util::SensorFrame& out_frame)>;
+
+    /// <summary> Settings shared by all virtual devices. </summary>
+    struct Settings
+    {
+        /// <summary> Frames per second, per device. </summary>
+        uint32_t PacketRateHz = 1000;
+
+        /// <summary> Publish every frame to the device's SensorChannel. </summary>
+        bool bWriteChannel = true;
+
+        /// <summary> Publish every frame to the device's SensorFrameRing. </summary>
+        bool bWriteRing = true;
+
+        /// <summary> Capacity of each SensorFrameRing. Must be a power of two. </summary>
+        uint32_t RingCapacity = Util::SensorFrameRing::GetDefaultCapacity();
+
+        /// <summary> Spin instead of sleeping for the last part of each period. Costs a core, but keeps the packet
+        /// interval steady at rates of a few kHz. </summary>
+        bool bSpinWait = false;
+    };
+
+    /// <summary> Returns true while any SimulatedBackend in this process is running. </summary>
+    static bool IsActive()
+    {
+        return ActiveInstances().load(std::memory_order_acquire) > 0;
+    }
+
+    /// <summary> Amount of raw sensor values the default pattern generates for a device type. </summary>
+    static uint8_t GetDefaultValueCount(EDeviceType deviceType)
+    {
+        switch (deviceType) {
+            case EDeviceType::SenseGlove:
+                return 20;// 5 fingers, 4 sensors each.
+            case EDeviceType::Nova2:
+                return 15;// 5 fingers, 3 movements each.
+            case EDeviceType::Nova:
+                return 10;// 5 fingers, flexion and abduction.
+            default:
+                return 0;
+        }
+    }
+
+private:
+    static std::atomic<int32_t>& ActiveInstances()
+    {
+        static std::atomic<int32_t> instances{0};
+        return instances;
+    }
+
+    struct VirtualDevice
+    {
+        int32_t DeviceIndex;
+        EDeviceType DeviceType;
+        FrameScript Script;
+        std::vector<Util::SensorFrame> Recording;
+        Util::SensorChannel Channel;
+        Util::SensorFrameRing Ring;
+    };
+
+private:
+    Settings Config;
+    std::vector<std::unique_ptr<VirtualDevice>> Devices;
+    std::thread Publisher;
+    std::atomic<bool> bRunning{false};
+    uint64_t NextSample = 0;
+    std::atomic<uint64_t> PublishedFrames{0};
+    std::atomic<uint64_t> Overruns{0};
+
+public:
+    SimulatedBackend() = default;
+
+    explicit SimulatedBackend(const Settings& settings)
+        : Config(settings)
+    {
+    }
+
+    SimulatedBackend(const SimulatedBackend& rhs) = delete;
+
+    ~SimulatedBackend()
+    {
+        Stop();
+    }
+
+public:
+    SimulatedBackend& operator=(const SimulatedBackend& rhs) = delete;
+
+public:
+    //--------------------------------------------------------------------------------------
+    // Devices
+
+    /// <summary> Add a virtual device that plays the default pattern of its type. Returns false while running.
+    /// </summary>
+    bool AddDevice(int32_t deviceIndex, EDeviceType deviceType)
+    {
+        return AddDevice(deviceIndex, deviceType, FrameScript());
+    }
+
+    /// <summary> Add a virtual device whose frames are produced by script. Returns false while running. </summary>
+    bool AddDevice(int32_t deviceIndex, EDeviceType deviceType, FrameScript script)
+    {
+        if (IsRunning()) {
+            return false;
+        }
+        std::unique_ptr<VirtualDevice> device(new VirtualDevice());
+        device->DeviceIndex = deviceIndex;
+        device->DeviceType = deviceType;
+        device->Script = std::move(script);
+        Devices.push_back(std::move(device));
+        return true;
+    }
+
+    /// <summary> Add a virtual device that replays recorded frames, e.g. drained from a SensorFrameRing, and loops
+    /// once it reaches the end. Returns false while running, or if the recording is empty. </summary>
+    bool AddRecordedDevice(int32_t deviceIndex, std::vector<Util::SensorFrame> recording)
+    {
+        if (IsRunning() || recording.empty()) {
+            return false;
+        }
+        std::unique_ptr<VirtualDevice> device(new VirtualDevice());
+        device->DeviceIndex = deviceIndex;
+        device->DeviceType = recording.front().GetDeviceType();
+        device->Recording = std::move(recording);
+        Devices.push_back(std::move(device));
+        return true;
+    }
+
+    /// <summary> Add count devices of the same type, with consecutive device indices starting at firstIndex.
+    /// </summary>
+    bool AddDevices(int32_t firstIndex, uint32_t count, EDeviceType deviceType)
+    {
+        for (uint32_t i = 0; i < count; ++i) {
+            if (!AddDevice(firstIndex + static_cast<int32_t>(i), deviceType)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /// <summary> Amount of virtual devices. </summary>
+    SG_NODISCARD std::size_t GetDeviceCount() const
+    {
+        return Devices.size();
+    }
+
+    //--------------------------------------------------------------------------------------
+    // Publishing
+
+    /// <summary> Open the shared memory blocks of all devices and start publishing at Settings::PacketRateHz.
+    /// Returns false if already running, or if a block could not be opened. </summary>
+    bool Start()
+    {
+        if (IsRunning() || Config.PacketRateHz == 0 || !Open()) {
+            return false;
+        }
+        bRunning.store(true, std::memory_order_release);
+        ActiveInstances().fetch_add(1, std::memory_order_acq_rel);
+        Publisher = std::thread(&SimulatedBackend::Run, this);
+        return true;
+    }
+
+    /// <summary> Stop publishing. The shared memory blocks stay open, so readers keep the last frame. </summary>
+    void Stop()
+    {
+        if (!bRunning.exchange(false, std::memory_order_acq_rel)) {
+            return;
+        }
+        if (Publisher.joinable()) {
+            Publisher.join();
+        }
+        ActiveInstances().fetch_sub(1, std::memory_order_acq_rel);
+    }
+
+    /// <summary> Returns true while the publishing thread runs. </summary>
+    SG_NODISCARD bool IsRunning() const
+    {
+        return bRunning.load(std::memory_order_acquire);
+    }
+
+    /// <summary> Publish a single frame for every device on the calling thread, without any timing. Useful for
+    /// fully deterministic tests. Opens the shared memory blocks if needed. Returns false while running. </summary>
+    bool Step()
+    {
+        if (IsRunning() || !Open()) {
+            return false;
+        }
+        PublishAll(Util::SensorFrame::NowNanoseconds());
+        return true;
+    }
+
+    /// <summary> Total frames published, over all devices. </summary>
+    SG_NODISCARD uint64_t GetPublishedFrames() const
+    {
+        return PublishedFrames.load(std::memory_order_relaxed);
+    }
+
+    /// <summary> Amount of periods the publisher fell so far behind that it had to skip ahead. </summary>
+    SG_NODISCARD uint64_t GetOverruns() const
+    {
+        return Overruns.load(std::memory_order_relaxed);
+    }
+
+private:
+    bool Open()
+    {
+        for (std::unique_ptr<VirtualDevice>& device : Devices) {
+            if (Config.bWriteChannel && !device->Channel.IsOpen() && !device->Channel.OpenWriter(device->DeviceIndex)) {
+                return false;
+            }
+            if (Config.bWriteRing && !device->Ring.IsOpen()
+                && !device->Ring.OpenProducer(device->DeviceIndex, Config.RingCapacity)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void Run()
+    {
+        Util::PeriodicTimer timer(Config.PacketRateHz, Config.bSpinWait);
+        while (bRunning.load(std::memory_order_acquire)) {
+            PublishAll(Util::SensorFrame::NowNanoseconds());
+            if (!timer.WaitForNextPeriod()) {
+                Overruns.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+    }
+
+    void PublishAll(uint64_t timestampNs)
+    {
+        const uint64_t sample = NextSample++;
+        Util::SensorFrame frame;
+        for (std::unique_ptr<VirtualDevice>& device : Devices) {
+            Generate(*device, sample, frame);
+            // Scripts start from a cleared frame and recordings carry their own stamps; replace both.
+            frame.LayoutVersion = Util::SensorFrame::GetLayoutVersion();
+            frame.Sequence = sample + 1;
+            frame.TimestampNs = timestampNs;
+            frame.PublishTimestampNs = 0;
+            if (device->Channel.IsOpen()) {
+                device->Channel.Publish(frame);// assigns the channel's own sequence number.
+            }
+            if (device->Ring.IsOpen()) {
+                device->Ring.Push(frame);
+            }
+        }
+        PublishedFrames.fetch_add(Devices.size(), std::memory_order_relaxed);
+    }
+
+    static void Generate(const VirtualDevice& device, uint64_t sample, Util::SensorFrame& out_frame)
+    {
+        if (!device.Recording.empty()) {
+            out_frame = device.Recording[sample % device.Recording.size()];
+            return;
+        }
+        out_frame.Clear();
+        out_frame.DeviceType = static_cast<int8_t>(device.DeviceType);
+        if (device.Script) {
+            device.Script(sample, out_frame);
+            return;
+        }
+        DefaultPattern(device, sample, out_frame);
+    }
+
+    /// <summary> Fingers opening and closing at slightly different speeds, a slowly turning wrist and a draining
+    /// battery. Values are normalized to [0..1]. </summary>
+    static void DefaultPattern(const VirtualDevice& device, uint64_t sample, Util::SensorFrame& out_frame)
+    {
+        const float time = static_cast<float>(sample % 1000000) * 0.001f;
+        const float devicePhase = static_cast<float>(device.DeviceIndex) * 0.37f;
+        const uint8_t count = GetDefaultValueCount(device.DeviceType);
+        for (uint8_t v = 0; v < count; ++v) {
+            const float speed = 1.0f + 0.1f * static_cast<float>(v % 5);
+            out_frame.Values[v] = 0.5f + 0.5f * std::sin(time * speed + devicePhase + static_cast<float>(v) * 0.2f);
+        }
+        out_frame.ValueCount = count;
+
+        const float halfYaw = 0.25f * std::sin(time * 0.5f + devicePhase);
+        out_frame.Imu[0] = 0.0f;
+        out_frame.Imu[1] = std::sin(halfYaw);
+        out_frame.Imu[2] = 0.0f;
+        out_frame.Imu[3] = std::cos(halfYaw);
+        out_frame.BatteryLevel = 1.0f - static_cast<float>(sample % 100000) / 100000.0f;
+        out_frame.Flags = Util::SensorFrame::Flag_ImuValid | Util::SensorFrame::Flag_Normalized;
+    }
+};
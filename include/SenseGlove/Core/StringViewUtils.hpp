@@ -0,0 +1,268 @@
+/**
+ * @file
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2026 SenseGlove
+ *
+ * @section DESCRIPTION
+ *
+ * Zero-copy counterparts of StringUtils and Serializer helpers. Tokens are
+ * returned as std::string_view into the original string, and numbers are
+ * parsed with std::from_chars, so splitting and converting does not allocate.
+ * Requires C++17.
+ */
+
+
+#pragma once
+
+#include "Platform.hpp"
+
+#if SG_CPP17
+
+#include <charconv>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <string_view>
+#include <system_error>
+#include <vector>
+
+namespace SGCore
+{
+    namespace Util
+    {
+        /// <summary> Zero-copy string utilities based on std::string_view. </summary>
+        class StringViewUtils;
+    }// namespace Util
+}// namespace SGCore
+
+/// <summary> Zero-copy string utilities based on std::string_view. </summary>
+/// <remarks> Every std::string_view returned by these functions points into the input, which must therefore
+/// outlive it. Functions that output multiple tokens or values take a vector from the caller and clear it first, so
+/// re-using the same vector avoids allocations after the first call. </remarks>
+class SGCore::Util::StringViewUtils
+{
+public:
+    /// <summary> Delimiter between values in a serialized float array, as used by Serializer. </summary>
+    static constexpr char GetValueDelimiter()
+    {
+        return ';';
+    }
+
+    /// <summary> Character that opens a serialized block, as used by Serializer::Enclose. </summary>
+    static constexpr char GetOpenChar()
+    {
+        return '{';
+    }
+
+    /// <summary> Character that closes a serialized block. </summary>
+    static constexpr char GetCloseChar()
+    {
+        return '}';
+    }
+
+public:
+    /// <summary> Iterates over the tokens of a string, separated by a delimiter, without copying them. </summary>
+    /// <remarks> Behaves like StringUtils::Split: empty tokens between two delimiters are returned as well, and an
+    /// empty input has no tokens. </remarks>
+    class Tokenizer
+    {
+    private:
+        std::string_view Remaining;
+        char Delimiter;
+        bool bDone;
+
+    public:
+        Tokenizer(std::string_view input, char delimiter)
+            : Remaining(input), Delimiter(delimiter), bDone(input.empty())
+        {
+        }
+
+        /// <summary> Retrieve the next token. Returns false once all tokens were returned. </summary>
+        bool Next(std::string_view& out_token)
+        {
+            if (bDone) {
+                return false;
+            }
+            const std::size_t split = Remaining.find(Delimiter);
+            if (split == std::string_view::npos) {
+                out_token = Remaining;
+                bDone = true;
+                return true;
+            }
+            out_token = Remaining.substr(0, split);
+            Remaining.remove_prefix(split + 1);
+            return true;
+        }
+    };
+
+public:
+    //--------------------------------------------------------------------------------------
+    // Splitting
+
+    /// <summary> Split input by a delimiter into out_tokens. Returns the amount of tokens. </summary>
+    static std::size_t Split(std::string_view input, char delimiter, std::vector<std::string_view>& out_tokens)
+    {
+        out_tokens.clear();
+        Tokenizer tokenizer(input, delimiter);
+        std::string_view token;
+        while (tokenizer.Next(token)) {
+            out_tokens.push_back(token);
+        }
+        return out_tokens.size();
+    }
+
+    /// <summary> Retrieve the token at getIndex, without splitting the rest of the string. Returns an empty view if
+    /// there are not that many tokens. </summary>
+    static std::string_view QuickSplit(std::string_view input, char delimiter, int32_t getIndex)
+    {
+        Tokenizer tokenizer(input, delimiter);
+        std::string_view token;
+        for (int32_t i = 0; tokenizer.Next(token); ++i) {
+            if (i == getIndex) {
+                return token;
+            }
+        }
+        return std::string_view();
+    }
+
+    /// <summary> Remove leading and trailing whitespace. </summary>
+    static std::string_view Trim(std::string_view input)
+    {
+        while (!input.empty() && IsSpace(input.front())) {
+            input.remove_prefix(1);
+        }
+        while (!input.empty() && IsSpace(input.back())) {
+            input.remove_suffix(1);
+        }
+        return input;
+    }
+
+    //--------------------------------------------------------------------------------------
+    // Numbers
+
+    /// <summary> Parse an integer value. Returns fallback if input does not start with a number. </summary>
+    static int32_t ToInt(std::string_view input, int32_t fallback = 0)
+    {
+        int32_t value = 0;
+        return TryParseInt(input, value) ? value : fallback;
+    }
+
+    /// <summary> Parse a decimal value. Returns fallback if input does not start with a number. </summary>
+    static float ToFloat(std::string_view input, float fallback = 0.0f)
+    {
+        float value = 0.0f;
+        return TryParseFloat(input, value) ? value : fallback;
+    }
+
+    /// <summary> Parse an integer value, ignoring surrounding whitespace and a leading '+'. Like std::stoi,
+    /// anything after the number is ignored. </summary>
+    static bool TryParseInt(std::string_view input, int32_t& out_value)
+    {
+        input = StripPlus(Trim(input));
+        const std::from_chars_result result = std::from_chars(input.data(), input.data() + input.size(), out_value);
+        return result.ec == std::errc() && result.ptr != input.data();
+    }
+
+    /// <summary> Parse a decimal value, ignoring surrounding whitespace and a leading '+'. Like std::stof,
+    /// anything after the number is ignored. </summary>
+    static bool TryParseFloat(std::string_view input, float& out_value)
+    {
+        input = StripPlus(Trim(input));
+        if (input.empty()) {
+            return false;
+        }
+#if defined ( __cpp_lib_to_chars ) && __cpp_lib_to_chars >= 201611L
+        const std::from_chars_result result = std::from_chars(input.data(), input.data() + input.size(), out_value);
+        return result.ec == std::errc() && result.ptr != input.data();
+#else   /* defined ( __cpp_lib_to_chars ) && __cpp_lib_to_chars >= 201611L */
+        // No floating point from_chars in this standard library; strtof on a null-terminated copy on the stack.
+        char buffer[64];
+        const std::size_t length = input.size() < sizeof(buffer) - 1 ? input.size() : sizeof(buffer) - 1;
+        std::memcpy(buffer, input.data(), length);
+        buffer[length] = '\0';
+        char* end = nullptr;
+        const float value = std::strtof(buffer, &end);
+        if (end == buffer) {
+            return false;
+        }
+        out_value = value;
+        return true;
+#endif  /* defined ( __cpp_lib_to_chars ) && __cpp_lib_to_chars >= 201611L */
+    }
+
+    //--------------------------------------------------------------------------------------
+    // Serialized strings
+
+    /// <summary> Remove one opening and closing character from the beginning and end of input, if they exist.
+    /// </summary>
+    static std::string_view FilterBrackets(std::string_view input)
+    {
+        if (!input.empty() && input.front() == GetOpenChar()) {
+            input.remove_prefix(1);
+        }
+        if (!input.empty() && input.back() == GetCloseChar()) {
+            input.remove_suffix(1);
+        }
+        return input;
+    }
+
+    /// <summary> Split a serialized string into its top-level blocks, e.g. "{a}{b{c}}" into "a" and "b{c}". The
+    /// enclosing characters of each block are not included. Returns false if the brackets do not match.
+    /// </summary>
+    static bool SplitBlocks(std::string_view serialized, std::vector<std::string_view>& out_blocks)
+    {
+        out_blocks.clear();
+        int32_t depth = 0;
+        std::size_t blockStart = 0;
+        for (std::size_t i = 0; i < serialized.size(); ++i) {
+            if (serialized[i] == GetOpenChar()) {
+                if (depth++ == 0) {
+                    blockStart = i + 1;
+                }
+            } else if (serialized[i] == GetCloseChar()) {
+                if (depth == 0) {
+                    return false;
+                }
+                if (--depth == 0) {
+                    out_blocks.push_back(serialized.substr(blockStart, i - blockStart));
+                }
+            }
+        }
+        return depth == 0;
+    }
+
+    /// <summary> Parse a serialized float array ("0.1;2;-3.5") into out_values. Values that are not numbers become
+    /// 0, as they do in Serializer::DeserializeFloats. Returns the amount of values. </summary>
+    static std::size_t DeserializeFloats(std::string_view serialized, std::vector<float>& out_values)
+    {
+        out_values.clear();
+        Tokenizer tokenizer(FilterBrackets(serialized), GetValueDelimiter());
+        std::string_view token;
+        while (tokenizer.Next(token)) {
+            out_values.push_back(ToFloat(token));
+        }
+        return out_values.size();
+    }
+
+private:
+    static SG_FORCEINLINE bool IsSpace(char c)
+    {
+        return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\f' || c == '\v';
+    }
+
+    static SG_FORCEINLINE std::string_view StripPlus(std::string_view input)
+    {
+        if (!input.empty() && input.front() == '+') {
+            input.remove_prefix(1);
+        }
+        return input;
+    }
+
+public:
+    StringViewUtils() = delete;
+    ~StringViewUtils() = delete;
+};
+
+#endif  /* SG_CPP17 */
@@ -0,0 +1,648 @@
+/**
+ * @file
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2026 SenseGlove
+ *
+ * @section DESCRIPTION
+ *
+ * Low-overhead alternative to Debugger::Log for hot paths. Trace events are
+ * recorded into a lock-free ring buffer per thread, with their arguments
+ * stored as raw values; messages are only formatted when the trace is
+ * exported to Chrome trace JSON or a compact binary file.
+ */
+
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+#include "Debugger.hpp"
+#include "Platform.hpp"
+
+/*******************************************************************************
+* Compile-time filtering
+*******************************************************************************/
+
+/* Highest EDebugLevel, as a number, for which SG_TRACE calls are compiled in. Define it as 0 to compile out all
+ * tracing, or as 5 (Haptics_Sent) to drop the Haptics_Queue and All levels from a build. */
+#if !defined ( SG_TRACE_MAX_LEVEL )
+#define SG_TRACE_MAX_LEVEL 7
+#endif  /* ! defined ( SG_TRACE_MAX_LEVEL ) */
+
+#define SG_TRACE_CONCAT_INNER(a, b) a##b
+#define SG_TRACE_CONCAT(a, b) SG_TRACE_CONCAT_INNER(a, b)
+
+/* Record a trace event: SG_TRACE(level, "format with {} placeholders", args...). The format and any const char*
+ * arguments must be string literals, or otherwise outlive the export. The arguments are not evaluated when the level
+ * is filtered out, either at compile time or at runtime. */
+#define SG_TRACE(level, ...)                                                                                        \
+    do {                                                                                                            \
+        if (::SGCore::Diagnostics::Tracer::IsCompiledIn(level)                                                      \
+            && ::SGCore::Diagnostics::Tracer::IsEnabled(level)) {                                                   \
+            ::SGCore::Diagnostics::Tracer::Record(level, __VA_ARGS__);                                              \
+        }                                                                                                           \
+    } while (0)
+
+/* Record the time spent in the current scope as a single event: SG_TRACE_SCOPE(level, "name"). */
+#define SG_TRACE_SCOPE(level, name)                                                                                 \
+    ::SGCore::Diagnostics::Tracer::Scope SG_TRACE_CONCAT(sgTraceScope, __LINE__)(level, name)
+
+namespace SGCore
+{
+    namespace Diagnostics
+    {
+        /// <summary> Records trace events into per-thread ring buffers, and exports them on demand. </summary>
+        class Tracer;
+    }// namespace Diagnostics
+}// namespace SGCore
+
+/// <summary> Records trace events into per-thread ring buffers, and exports them on demand. </summary>
+/// <remarks> Recording does not lock, allocate or format: the calling thread copies a timestamp, the address of the
+/// format string and up to MaxArgs raw arguments into its own ring buffer. When a buffer is full, new events are
+/// dropped and counted. Export functions drain every buffer, so call one of them periodically to keep tracing on in
+/// production; they may be called from any thread, but only one export runs at a time. The level filter is
+/// separate from Debugger::SetDebugLevel, and is Disabled until SetLevel is called. </remarks>
+class SGCore::Diagnostics::Tracer
+{
+public:
+    /// <summary> Maximum amount of arguments stored per event. Further arguments are ignored. </summary>
+    static constexpr uint8_t MaxArgs = 4;
+
+    /// <summary> Events each thread can buffer between two exports, unless changed with SetBufferCapacity.
+    /// </summary>
+    static constexpr uint32_t DefaultBufferCapacity = 4096;
+
+    /// <summary> Type of a stored argument. </summary>
+    enum class EArgType : uint8_t
+    {
+        None = 0,
+        Int,
+        UInt,
+        Float,
+        Bool,
+        Text
+    };
+
+    /// <summary> Kind of trace event. </summary>
+    enum class EEventType : uint8_t
+    {
+        /// <summary> A message at a single point in time. </summary>
+        Instant = 0,
+
+        /// <summary> A named span of time, recorded by SG_TRACE_SCOPE. </summary>
+        Complete
+    };
+
+    /// <summary> A single argument, stored as its raw value. </summary>
+    union Arg
+    {
+        int64_t Int;
+        uint64_t UInt;
+        double Float;
+        const char* Text;
+    };
+
+    /// <summary> A recorded event, as it is stored in the ring buffers. </summary>
+    struct Event
+    {
+        /// <summary> steady_clock time at which the event was recorded (or the scope started), in nanoseconds.
+        /// </summary>
+        uint64_t TimestampNs;
+
+        /// <summary> Duration of a Complete event, in nanoseconds. 0 for Instant events. </summary>
+        uint64_t DurationNs;
+
+        /// <summary> The format string, or the scope name. Not owned. </summary>
+        const char* Format;
+
+        Arg Args[MaxArgs];
+        EArgType ArgTypes[MaxArgs];
+
+        /// <summary> Small, sequential id of the recording thread, starting at 1. </summary>
+        uint32_t ThreadId;
+
+        EDebugLevel Level;
+        EEventType Type;
+        uint8_t ArgCount;
+    };
+
+    /// <summary> Times a scope, and records it as a Complete event when it ends. </summary>
+    class Scope
+    {
+    private:
+        EDebugLevel Level;
+        const char* Name;
+        uint64_t StartNs;
+
+    public:
+        Scope(EDebugLevel level, const char* name)
+            : Level(level), Name(name), StartNs(IsCompiledIn(level) && IsEnabled(level) ? NowNanoseconds() : 0)
+        {
+        }
+
+        Scope(const Scope& rhs) = delete;
+
+        ~Scope()
+        {
+            if (StartNs != 0) {
+                RecordComplete(Level, Name, StartNs, NowNanoseconds() - StartNs);
+            }
+        }
+
+    public:
+        Scope& operator=(const Scope& rhs) = delete;
+    };
+
+private:
+    /// <summary> Single-producer, single-consumer ring owned by one recording thread. </summary>
+    struct ThreadBuffer
+    {
+        std::vector<Event> Events;
+        uint64_t Mask;
+        uint32_t ThreadId;
+        std::atomic<uint64_t> Head{0};
+        std::atomic<uint64_t> Tail{0};
+        std::atomic<uint64_t> Dropped{0};
+        std::atomic<bool> bRetired{false};
+
+        ThreadBuffer(uint32_t capacity, uint32_t threadId)
+            : Events(capacity), Mask(capacity - 1), ThreadId(threadId)
+        {
+        }
+    };
+
+    /// <summary> All thread buffers, including those of threads that exited but were not drained yet. </summary>
+    struct Registry
+    {
+        std::mutex Mutex;// guards Buffers and serializes exports.
+        std::vector<std::shared_ptr<ThreadBuffer>> Buffers;
+        uint32_t NextThreadId = 1;
+        std::atomic<uint32_t> Capacity{DefaultBufferCapacity};
+        std::atomic<uint8_t> Level{static_cast<uint8_t>(EDebugLevel::Disabled)};
+        std::atomic<uint64_t> RetiredDropped{0};
+    };
+
+    /// <summary> Marks the calling thread's buffer as retired when the thread exits. </summary>
+    struct ThreadBufferHolder
+    {
+        std::shared_ptr<ThreadBuffer> Buffer;
+
+        ~ThreadBufferHolder()
+        {
+            if (Buffer != nullptr) {
+                Buffer->bRetired.store(true, std::memory_order_release);
+            }
+        }
+    };
+
+public:
+    //--------------------------------------------------------------------------------------
+    // Filtering
+
+    /// <summary> Returns true if events of level are compiled in, see SG_TRACE_MAX_LEVEL. </summary>
+    static constexpr bool IsCompiledIn(EDebugLevel level)
+    {
+        return level != EDebugLevel::Disabled && static_cast<uint8_t>(level) <= SG_TRACE_MAX_LEVEL;
+    }
+
+    /// <summary> Returns true if events of level are currently recorded. </summary>
+    static SG_FORCEINLINE bool IsEnabled(EDebugLevel level)
+    {
+        return static_cast<uint8_t>(level) <= GetRegistry().Level.load(std::memory_order_relaxed)
+               && level != EDebugLevel::Disabled;
+    }
+
+    /// <summary> The highest level that is recorded. </summary>
+    static EDebugLevel GetLevel()
+    {
+        return static_cast<EDebugLevel>(GetRegistry().Level.load(std::memory_order_relaxed));
+    }
+
+    /// <summary> Record events up to and including level. Disabled stops recording. </summary>
+    static void SetLevel(EDebugLevel level)
+    {
+        GetRegistry().Level.store(static_cast<uint8_t>(level), std::memory_order_relaxed);
+    }
+
+    /// <summary> Events each thread can buffer, rounded up to a power of two. Only applies to threads that record
+    /// their first event after this call. </summary>
+    static void SetBufferCapacity(uint32_t capacity)
+    {
+        uint32_t rounded = 2;
+        while (rounded < capacity && rounded < (1u << 30)) {
+            rounded <<= 1;
+        }
+        GetRegistry().Capacity.store(rounded, std::memory_order_relaxed);
+    }
+
+    //--------------------------------------------------------------------------------------
+    // Recording
+
+    /// <summary> Record an Instant event. Prefer SG_TRACE, which skips argument evaluation for disabled levels.
+    /// </summary>
+    template<typename... Args>
+    static void Record(EDebugLevel level, const char* format, const Args&... args)
+    {
+        Event event;
+        event.TimestampNs = NowNanoseconds();
+        event.DurationNs = 0;
+        event.Format = format;
+        event.Level = level;
+        event.Type = EEventType::Instant;
+        event.ArgCount = 0;
+        PackArgs(event, args...);
+        Push(event);
+    }
+
+    /// <summary> Record a Complete event that started at startNs and lasted durationNs. </summary>
+    static void RecordComplete(EDebugLevel level, const char* name, uint64_t startNs, uint64_t durationNs)
+    {
+        Event event;
+        event.TimestampNs = startNs;
+        event.DurationNs = durationNs;
+        event.Format = name;
+        event.Level = level;
+        event.Type = EEventType::Complete;
+        event.ArgCount = 0;
+        Push(event);
+    }
+
+    /// <summary> The clock used for all timestamps, in nanoseconds. </summary>
+    static uint64_t NowNanoseconds()
+    {
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now().time_since_epoch()).count());
+    }
+
+    /// <summary> Amount of events dropped because a thread's buffer was full. </summary>
+    static uint64_t GetDroppedEvents()
+    {
+        Registry& registry = GetRegistry();
+        std::lock_guard<std::mutex> lock(registry.Mutex);
+        uint64_t dropped = registry.RetiredDropped.load(std::memory_order_relaxed);
+        for (const std::shared_ptr<ThreadBuffer>& buffer : registry.Buffers) {
+            dropped += buffer->Dropped.load(std::memory_order_relaxed);
+        }
+        return dropped;
+    }
+
+    //--------------------------------------------------------------------------------------
+    // Exporting
+
+    /// <summary> Move every buffered event into out_events, ordered by timestamp. Re-use out_events between calls
+    /// to avoid allocations. Returns the amount of events. </summary>
+    static std::size_t Drain(std::vector<Event>& out_events)
+    {
+        out_events.clear();
+        Registry& registry = GetRegistry();
+        std::lock_guard<std::mutex> lock(registry.Mutex);
+        for (std::size_t i = 0; i < registry.Buffers.size();) {
+            ThreadBuffer& buffer = *registry.Buffers[i];
+            const bool bRetired = buffer.bRetired.load(std::memory_order_acquire);
+            const uint64_t tail = buffer.Tail.load(std::memory_order_relaxed);
+            const uint64_t head = buffer.Head.load(std::memory_order_acquire);
+            for (uint64_t index = tail; index != head; ++index) {
+                out_events.push_back(buffer.Events[index & buffer.Mask]);
+            }
+            buffer.Tail.store(head, std::memory_order_release);
+            if (bRetired) {
+                registry.RetiredDropped.fetch_add(buffer.Dropped.load(std::memory_order_relaxed),
+                                                  std::memory_order_relaxed);
+                registry.Buffers.erase(registry.Buffers.begin() + static_cast<std::ptrdiff_t>(i));
+            } else {
+                ++i;
+            }
+        }
+        std::stable_sort(out_events.begin(), out_events.end(), [](const Event& lhs, const Event& rhs) {
+            return lhs.TimestampNs < rhs.TimestampNs;
+        });
+        return out_events.size();
+    }
+
+    /// <summary> Format an event's message, replacing each {} in its format with the next argument. </summary>
+    static std::string FormatMessage(const Event& event)
+    {
+        std::string message;
+        if (event.Format == nullptr) {
+            return message;
+        }
+        uint8_t arg = 0;
+        for (const char* c = event.Format; *c != '\0'; ++c) {
+            if (c[0] == '{' && c[1] == '}' && arg < event.ArgCount) {
+                AppendArg(message, event.Args[arg], event.ArgTypes[arg]);
+                ++arg;
+                ++c;
+            } else {
+                message += *c;
+            }
+        }
+        return message;
+    }
+
+    /// <summary> Drain all buffers into out_stream as Chrome trace event JSON, which can be opened in
+    /// chrome://tracing or Perfetto. Returns the amount of events written. </summary>
+    static std::size_t WriteChromeTrace(std::ostream& out_stream)
+    {
+        std::vector<Event> events;
+        Drain(events);
+        out_stream << "{\"traceEvents\":[";
+        char number[64];
+        for (std::size_t i = 0; i < events.size(); ++i) {
+            const Event& event = events[i];
+            out_stream << (i == 0 ? "\n" : ",\n") << "{\"name\":\"";
+            AppendJsonEscaped(out_stream, FormatMessage(event));
+            out_stream << "\",\"cat\":\"" << ToString(event.Level) << "\",\"ph\":\""
+                       << (event.Type == EEventType::Complete ? "X" : "i") << "\",\"pid\":1,\"tid\":"
+                       << event.ThreadId;
+            std::snprintf(number, sizeof(number), "%.3f", static_cast<double>(event.TimestampNs) / 1000.0);
+            out_stream << ",\"ts\":" << number;
+            if (event.Type == EEventType::Complete) {
+                std::snprintf(number, sizeof(number), "%.3f", static_cast<double>(event.DurationNs) / 1000.0);
+                out_stream << ",\"dur\":" << number;
+            } else {
+                out_stream << ",\"s\":\"t\"";
+            }
+            out_stream << "}";
+        }
+        out_stream << "\n]}\n";
+        return events.size();
+    }
+
+    /// <summary> As WriteChromeTrace(out_stream), into a file. Returns false if the file could not be
+    /// opened. </summary>
+    static bool WriteChromeTrace(const std::string& filePath)
+    {
+        std::ofstream file(filePath, std::ios::out | std::ios::trunc);
+        if (!file.is_open()) {
+            return false;
+        }
+        WriteChromeTrace(file);
+        return file.good();
+    }
+
+    /// <summary> Drain all buffers into out_stream in the compact binary format. Returns the amount of events
+    /// written. </summary>
+    /// <remarks> All values are little-endian. The stream starts with the magic "SGTR" and a uint32 version (1),
+    /// followed by records that each start with a uint8 tag. Tag 1 defines a string: uint32 id, uint32 length and
+    /// the bytes. Tag 2 is an event: uint64 timestamp, uint64 duration (both ns), uint32 thread id, uint8 level,
+    /// uint8 type, uint32 format string id, uint8 argument count, and per argument a uint8 EArgType followed by
+    /// 8 bytes of value, or a uint32 string id for Text. Strings are defined once, before their first use.
+    /// </remarks>
+    static std::size_t WriteBinary(std::ostream& out_stream)
+    {
+        std::vector<Event> events;
+        Drain(events);
+        std::unordered_map<const char*, uint32_t> stringIds;
+        out_stream.write("SGTR", 4);
+        WriteLE(out_stream, static_cast<uint32_t>(1));
+        for (const Event& event : events) {
+            const uint32_t formatId = DefineString(out_stream, stringIds, event.Format);
+            uint32_t textIds[MaxArgs] = {0};
+            for (uint8_t i = 0; i < event.ArgCount; ++i) {
+                if (event.ArgTypes[i] == EArgType::Text) {
+                    textIds[i] = DefineString(out_stream, stringIds, event.Args[i].Text);
+                }
+            }
+            WriteLE(out_stream, static_cast<uint8_t>(2));
+            WriteLE(out_stream, event.TimestampNs);
+            WriteLE(out_stream, event.DurationNs);
+            WriteLE(out_stream, event.ThreadId);
+            WriteLE(out_stream, static_cast<uint8_t>(event.Level));
+            WriteLE(out_stream, static_cast<uint8_t>(event.Type));
+            WriteLE(out_stream, formatId);
+            WriteLE(out_stream, event.ArgCount);
+            for (uint8_t i = 0; i < event.ArgCount; ++i) {
+                WriteLE(out_stream, static_cast<uint8_t>(event.ArgTypes[i]));
+                if (event.ArgTypes[i] == EArgType::Text) {
+                    WriteLE(out_stream, textIds[i]);
+                } else {
+                    WriteLE(out_stream, event.Args[i].UInt);
+                }
+            }
+        }
+        return events.size();
+    }
+
+    /// <summary> As WriteBinary(out_stream), into a file. Returns false if the file could not be opened. </summary>
+    static bool WriteBinary(const std::string& filePath)
+    {
+        std::ofstream file(filePath, std::ios::out | std::ios::binary | std::ios::trunc);
+        if (!file.is_open()) {
+            return false;
+        }
+        WriteBinary(file);
+        return file.good();
+    }
+
+    /// <summary> Name of a level, as used for the Chrome trace category. </summary>
+    static const char* ToString(EDebugLevel level)
+    {
+        switch (level) {
+            case EDebugLevel::Disabled: return "Disabled";
+            case EDebugLevel::ErrorsOnly: return "ErrorsOnly";
+            case EDebugLevel::CallibrationMessages: return "Calibration";
+            case EDebugLevel::DeviceParsing: return "DeviceParsing";
+            case EDebugLevel::BackendCommunication: return "BackendCommunication";
+            case EDebugLevel::Haptics_Sent: return "Haptics_Sent";
+            case EDebugLevel::Haptics_Queue: return "Haptics_Queue";
+            case EDebugLevel::All: return "All";
+        }
+        return "Unknown";
+    }
+
+private:
+    static Registry& GetRegistry()
+    {
+        static Registry registry;
+        return registry;
+    }
+
+    static ThreadBuffer& GetThreadBuffer()
+    {
+        static thread_local ThreadBufferHolder holder;
+        if (holder.Buffer == nullptr) {
+            Registry& registry = GetRegistry();
+            std::lock_guard<std::mutex> lock(registry.Mutex);
+            holder.Buffer = std::make_shared<ThreadBuffer>(registry.Capacity.load(std::memory_order_relaxed),
+                                                           registry.NextThreadId++);
+            registry.Buffers.push_back(holder.Buffer);
+        }
+        return *holder.Buffer;
+    }
+
+    static void Push(Event& event)
+    {
+        ThreadBuffer& buffer = GetThreadBuffer();
+        event.ThreadId = buffer.ThreadId;
+        const uint64_t head = buffer.Head.load(std::memory_order_relaxed);
+        const uint64_t tail = buffer.Tail.load(std::memory_order_acquire);
+        if (head - tail > buffer.Mask) {
+            buffer.Dropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        buffer.Events[head & buffer.Mask] = event;
+        buffer.Head.store(head + 1, std::memory_order_release);
+    }
+
+    //--------------------------------------------------------------------------------------
+    // Argument packing
+
+    static void PackArgs(Event&)
+    {
+    }
+
+    template<typename T, typename... Rest>
+    static void PackArgs(Event& event, const T& value, const Rest&... rest)
+    {
+        if (event.ArgCount < MaxArgs) {
+            SetArg(event.Args[event.ArgCount], event.ArgTypes[event.ArgCount], value);
+            ++event.ArgCount;
+        }
+        PackArgs(event, rest...);
+    }
+
+    static void SetArg(Arg& out_arg, EArgType& out_type, bool value)
+    {
+        out_arg.UInt = value ? 1 : 0;
+        out_type = EArgType::Bool;
+    }
+
+    static void SetArg(Arg& out_arg, EArgType& out_type, const char* value)
+    {
+        out_arg.Text = value;
+        out_type = EArgType::Text;
+    }
+
+    template<typename T>
+    static typename std::enable_if<std::is_floating_point<T>::value>::type
+    SetArg(Arg& out_arg, EArgType& out_type, T value)
+    {
+        out_arg.Float = static_cast<double>(value);
+        out_type = EArgType::Float;
+    }
+
+    template<typename T>
+    static typename std::enable_if<std::is_integral<T>::value && std::is_signed<T>::value>::type
+    SetArg(Arg& out_arg, EArgType& out_type, T value)
+    {
+        out_arg.Int = static_cast<int64_t>(value);
+        out_type = EArgType::Int;
+    }
+
+    template<typename T>
+    static typename std::enable_if<std::is_integral<T>::value && std::is_unsigned<T>::value
+                                   && !std::is_same<T, bool>::value>::type
+    SetArg(Arg& out_arg, EArgType& out_type, T value)
+    {
+        out_arg.UInt = static_cast<uint64_t>(value);
+        out_type = EArgType::UInt;
+    }
+
+    template<typename T>
+    static typename std::enable_if<std::is_enum<T>::value>::type
+    SetArg(Arg& out_arg, EArgType& out_type, T value)
+    {
+        out_arg.Int = static_cast<int64_t>(value);
+        out_type = EArgType::Int;
+    }
+
+    //--------------------------------------------------------------------------------------
+    // Formatting
+
+    static void AppendArg(std::string& out_message, const Arg& arg, EArgType type)
+    {
+        char buffer[32];
+        switch (type) {
+            case EArgType::Int:
+                std::snprintf(buffer, sizeof(buffer), "%lld", static_cast<long long>(arg.Int));
+                break;
+            case EArgType::UInt:
+                std::snprintf(buffer, sizeof(buffer), "%llu", static_cast<unsigned long long>(arg.UInt));
+                break;
+            case EArgType::Float:
+                std::snprintf(buffer, sizeof(buffer), "%g", arg.Float);
+                break;
+            case EArgType::Bool:
+                out_message += arg.UInt != 0 ? "true" : "false";
+                return;
+            case EArgType::Text:
+                out_message += arg.Text != nullptr ? arg.Text : "(null)";
+                return;
+            case EArgType::None:
+            default:
+                return;
+        }
+        out_message += buffer;
+    }
+
+    static void AppendJsonEscaped(std::ostream& out_stream, const std::string& text)
+    {
+        for (char c : text) {
+            switch (c) {
+                case '"': out_stream << "\\\""; break;
+                case '\\': out_stream << "\\\\"; break;
+                case '\n': out_stream << "\\n"; break;
+                case '\r': out_stream << "\\r"; break;
+                case '\t': out_stream << "\\t"; break;
+                default:
+                    if (static_cast<unsigned char>(c) < 0x20) {
+                        char escaped[8];
+                        std::snprintf(escaped, sizeof(escaped), "\\u%04x", static_cast<unsigned int>(c));
+                        out_stream << escaped;
+                    } else {
+                        out_stream << c;
+                    }
+            }
+        }
+    }
+
+    template<typename T>
+    static void WriteLE(std::ostream& out_stream, T value)
+    {
+        unsigned char bytes[sizeof(T)];
+        for (std::size_t i = 0; i < sizeof(T); ++i) {
+            bytes[i] = static_cast<unsigned char>((static_cast<uint64_t>(value) >> (8 * i)) & 0xFFu);
+        }
+        out_stream.write(reinterpret_cast<const char*>(bytes), sizeof(T));
+    }
+
+    static uint32_t DefineString(std::ostream& out_stream, std::unordered_map<const char*, uint32_t>& out_ids,
+                                 const char* text)
+    {
+        if (text == nullptr) {
+            text = "";
+        }
+        const std::unordered_map<const char*, uint32_t>::const_iterator found = out_ids.find(text);
+        if (found != out_ids.end()) {
+            return found->second;
+        }
+        const uint32_t id = static_cast<uint32_t>(out_ids.size());
+        out_ids.emplace(text, id);
+        const uint32_t length = static_cast<uint32_t>(std::strlen(text));
+        WriteLE(out_stream, static_cast<uint8_t>(1));
+        WriteLE(out_stream, id);
+        WriteLE(out_stream, length);
+        out_stream.write(text, length);
+        return id;
+    }
+
+public:
+    Tracer() = delete;
+    virtual ~Tracer() = delete;
+};
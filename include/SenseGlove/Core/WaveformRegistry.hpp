@@ -0,0 +1,245 @@
+/**
+ * @file
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2026 SenseGlove
+ *
+ * @section DESCRIPTION
+ *
+ * Validates and encodes CustomWaveforms once, when they are registered, so
+ * that playing them afterwards only hands a pre-built command to the glove's
+ * fire-and-forget channel.
+ */
+
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "CustomWaveform.hpp"
+#include "DeviceList.hpp"
+#include "DeviceTypes.hpp"
+#include "HapticChannelInfo.hpp"
+#include "HapticGlove.hpp"
+#include "Nova2Glove.hpp"
+#include "NovaGlove.hpp"
+#include "NovaGloveHapticEncoder.hpp"
+#include "Platform.hpp"
+#include "SGDevice.hpp"
+
+namespace SGCore
+{
+    namespace Haptics
+    {
+        /// <summary> Identifies a waveform that was registered with a WaveformRegistry. </summary>
+        using WaveformHandle = int32_t;
+
+        /// <summary> Caches validated and encoded CustomWaveforms, which can then be sent by handle. </summary>
+        class WaveformRegistry;
+    }// namespace Haptics
+}// namespace SGCore
+
+/// <summary> Caches validated and encoded CustomWaveforms, which can then be sent by handle. </summary>
+/// <remarks> SendCustomWaveform validates the waveform against the motor, and encodes it into a new command, every
+/// time it is called. Register does both once, for a single motor of a Nova 1.0 or Nova 2.0 glove model, and returns
+/// a handle. Send(handle, glove) then only looks up the glove's fire-and-forget channel, and passes the cached command
+/// to DeviceList::SendHaptics. A handle may be sent to any glove of the model it was registered for. Registering takes
+/// a lock; sending does not, and may happen from multiple threads at once. Handles stay valid until Clear() is called,
+/// which must not happen while another thread is sending. </remarks>
+class SGCore::Haptics::WaveformRegistry
+{
+public:
+    /// <summary> Returned by Register when the waveform could not be registered. </summary>
+    static constexpr WaveformHandle InvalidHandle = -1;
+
+    /// <summary> Maximum amount of waveforms a registry holds, so that handles never move in memory. </summary>
+    static constexpr std::size_t DefaultCapacity = 256;
+
+private:
+    /// <summary> A validated waveform and its encoded command. </summary>
+    struct Entry
+    {
+        SGCore::CustomWaveform Waveform;
+        EDeviceType DeviceType = EDeviceType::Unknown;
+        int32_t Motor = 0;
+        int32_t ChannelIndex = -1;
+        std::string Command;
+
+        explicit Entry(const SGCore::CustomWaveform& waveform)
+            : Waveform(waveform)
+        {
+        }
+    };
+
+    /// <summary> Exposes SGDevice's protected channel lookup, which SendCustomWaveform uses internally. Never
+    /// instantiated. </summary>
+    struct IpcParamsAccess : public SGDevice
+    {
+        static void Get(const SGDevice& device, int32_t channelIndex, int32_t& out_index,
+                        std::string& out_address)
+        {
+            (device.*(&IpcParamsAccess::GetIpcParams_Unguarded))(EHapticChannelType::FireAndForgetChannel,
+                                                                  channelIndex, out_index, out_address);
+        }
+    };
+
+private:
+    std::vector<Entry> Entries;
+    std::size_t Capacity;
+    std::atomic<std::size_t> Count{0};
+    std::mutex RegisterMutex;
+
+public:
+    /// <summary> Create a registry that can hold up to capacity waveforms. </summary>
+    explicit WaveformRegistry(std::size_t capacity = DefaultCapacity)
+        : Capacity(capacity)
+    {
+        Entries.reserve(capacity);
+    }
+
+    WaveformRegistry(const WaveformRegistry& rhs) = delete;
+
+    ~WaveformRegistry() = default;
+
+public:
+    WaveformRegistry& operator=(const WaveformRegistry& rhs) = delete;
+
+public:
+    //--------------------------------------------------------------------------------------
+    // Registration
+
+    /// <summary> Validate and encode waveform for a motor of a Nova 2.0 glove. Returns InvalidHandle if the glove
+    /// has no fire-and-forget channel for that motor, or if the registry is full. </summary>
+    WaveformHandle Register(Nova::Nova2Glove& glove, const SGCore::CustomWaveform& waveform,
+                            Nova::ENova2VibroMotor motor)
+    {
+        Entry entry(waveform);
+        entry.DeviceType = EDeviceType::Nova2;
+        entry.Motor = static_cast<int32_t>(motor);
+        entry.ChannelIndex = glove.ChannelIndex(motor);
+        if (!IsValidChannel(glove, entry.ChannelIndex)) {
+            return InvalidHandle;
+        }
+        glove.ValidateWaveform(entry.Waveform, motor);
+        entry.Command = Nova::NovaGloveHapticEncoder::ToNova2Command(entry.Waveform, entry.Motor);
+        return Add(std::move(entry));
+    }
+
+    /// <summary> Validate and encode waveform for a motor of a Nova 1.0 glove. Returns InvalidHandle if the glove
+    /// has no fire-and-forget channel for that motor, or if the registry is full. </summary>
+    WaveformHandle Register(const Nova::NovaGlove& glove, const SGCore::CustomWaveform& waveform,
+                            Nova::ENovaVibroMotor motor)
+    {
+        Entry entry(waveform);
+        entry.DeviceType = EDeviceType::Nova;
+        entry.Motor = static_cast<int32_t>(motor);
+        entry.ChannelIndex = glove.ChannelIndex(motor);
+        if (!IsValidChannel(glove, entry.ChannelIndex)) {
+            return InvalidHandle;
+        }
+        glove.ValidateWaveform(entry.Waveform, motor);
+        entry.Command = Nova::NovaGloveHapticEncoder::ToNovaCommand(entry.Waveform, entry.Motor);
+        return Add(std::move(entry));
+    }
+
+    /// <summary> Validate and encode waveform for the motor at a location on a Nova 1.0 or Nova 2.0 glove. Returns
+    /// InvalidHandle for other gloves, which do not support custom waveforms. </summary>
+    WaveformHandle Register(HapticGlove& glove, const SGCore::CustomWaveform& waveform, EHapticLocation location)
+    {
+        Nova::Nova2Glove* nova2 = dynamic_cast<Nova::Nova2Glove*>(&glove);
+        if (nova2 != nullptr) {
+            return Register(*nova2, waveform, nova2->ToNova2Motor(location));
+        }
+        const Nova::NovaGlove* nova = dynamic_cast<const Nova::NovaGlove*>(&glove);
+        if (nova != nullptr) {
+            return Register(*nova, waveform, nova->ToNovaMotor(location));
+        }
+        return InvalidHandle;
+    }
+
+    /// <summary> Remove all waveforms. Invalidates every handle. </summary>
+    void Clear()
+    {
+        std::lock_guard<std::mutex> lock(RegisterMutex);
+        Count.store(0, std::memory_order_release);
+        Entries.clear();
+    }
+
+    //--------------------------------------------------------------------------------------
+    // Accessors
+
+    /// <summary> Amount of registered waveforms. </summary>
+    SG_NODISCARD std::size_t GetCount() const
+    {
+        return Count.load(std::memory_order_acquire);
+    }
+
+    /// <summary> Returns true if handle refers to a registered waveform. </summary>
+    SG_NODISCARD bool IsValid(WaveformHandle handle) const
+    {
+        return handle >= 0 && static_cast<std::size_t>(handle) < GetCount();
+    }
+
+    /// <summary> The validated waveform behind a handle. Only call this with a valid handle. </summary>
+    SG_NODISCARD const SGCore::CustomWaveform& GetWaveform(WaveformHandle handle) const
+    {
+        return Entries[static_cast<std::size_t>(handle)].Waveform;
+    }
+
+    /// <summary> The encoded command behind a handle, as NovaGloveHapticEncoder would produce it. Only call this
+    /// with a valid handle. </summary>
+    SG_NODISCARD const std::string& GetCommand(WaveformHandle handle) const
+    {
+        return Entries[static_cast<std::size_t>(handle)].Command;
+    }
+
+    /// <summary> The glove model a handle was registered for. </summary>
+    SG_NODISCARD EDeviceType GetDeviceType(WaveformHandle handle) const
+    {
+        return IsValid(handle) ? Entries[static_cast<std::size_t>(handle)].DeviceType : EDeviceType::Unknown;
+    }
+
+    //--------------------------------------------------------------------------------------
+    // Sending
+
+    /// <summary> Send a registered waveform to glove. Returns false if the handle is invalid, if glove is not of the
+    /// model the waveform was registered for, if it is not connected, or if SenseCom could not be reached. </summary>
+    bool Send(WaveformHandle handle, const SGDevice& glove) const
+    {
+        if (!IsValid(handle)) {
+            return false;
+        }
+        const Entry& entry = Entries[static_cast<std::size_t>(handle)];
+        if (glove.GetDeviceType() != entry.DeviceType || !glove.IsConnected()
+            || !IsValidChannel(glove, entry.ChannelIndex)) {
+            return false;
+        }
+        int32_t ipcIndex;
+        std::string ipcAddress;
+        IpcParamsAccess::Get(glove, entry.ChannelIndex, ipcIndex, ipcAddress);
+        return DeviceList::SendHaptics(glove.GetDeviceIndex(), ipcAddress, ipcIndex, entry.Command);
+    }
+
+private:
+    static bool IsValidChannel(const SGDevice& glove, int32_t channelIndex)
+    {
+        return channelIndex >= 0
+            && channelIndex < glove.GetHapticChannelCount(EHapticChannelType::FireAndForgetChannel);
+    }
+
+    WaveformHandle Add(Entry&& entry)
+    {
+        std::lock_guard<std::mutex> lock(RegisterMutex);
+        if (Entries.size() >= Capacity) {
+            return InvalidHandle;
+        }
+        Entries.push_back(std::move(entry));
+        Count.store(Entries.size(), std::memory_order_release);
+        return static_cast<WaveformHandle>(Entries.size() - 1);
+    }
+};
@@ -0,0 +1,325 @@
+/**
+ * @file
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2026 SenseGlove
+ *
+ * @section DESCRIPTION
+ *
+ * Plays HapticTimelines on one or more gloves from a single timer thread,
+ * instead of one sleeping thread per effect. Every waveform is sent through
+ * the glove's fire-and-forget channel at its scheduled time.
+ */
+
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "CustomWaveform.hpp"
+#include "HapticGlove.hpp"
+#include "HapticTimeline.hpp"
+#include "PeriodicTimer.hpp"
+#include "Platform.hpp"
+
+namespace SGCore
+{
+    /// <summary> Sends the waveforms of HapticTimelines at their scheduled times, from one timer thread. </summary>
+    class WaveformSequencer;
+}// namespace SGCore
+
+/// <summary> Sends the waveforms of HapticTimelines at their scheduled times, from a single timer thread. </summary>
+/// <remarks> Play() turns a timeline into timed events on a priority queue, ordered by time. The timer thread sleeps
+/// until the earliest event is due, and wakes up early when an earlier one is added. Pulses due at the same time are
+/// sent in the order they were added. Play, Cancel and the statistics can be used from any thread. Gloves are held by
+/// weak_ptr; events for a glove that was destroyed or disconnected are dropped. </remarks>
+class SGCore::WaveformSequencer
+{
+public:
+    using Clock = std::chrono::steady_clock;
+
+    /// <summary> Identifies a timeline that was started with Play. 0 is never used. </summary>
+    using PlaybackId = uint32_t;
+
+    /// <summary> Returned by Play when nothing was scheduled. </summary>
+    static constexpr PlaybackId InvalidPlayback = 0;
+
+    /// <summary> Settings of the timer thread. </summary>
+    struct Settings
+    {
+        /// <summary> Spin instead of sleeping for the last part of the wait before each event. Costs a core while
+        /// an event is due, but sends within a few microseconds of the scheduled time. </summary>
+        bool bSpinWait = false;
+    };
+
+private:
+    /// <summary> A single waveform, due at a point in time. </summary>
+    struct Event
+    {
+        Clock::time_point When;
+        uint64_t Order;
+        PlaybackId Playback;
+        std::weak_ptr<HapticGlove> Glove;
+        EHapticLocation Location;
+        SGCore::CustomWaveform Waveform;
+
+        Event(Clock::time_point when, uint64_t order, PlaybackId playback, const std::weak_ptr<HapticGlove>& glove,
+              EHapticLocation location, const SGCore::CustomWaveform& waveform)
+            : When(when), Order(order), Playback(playback), Glove(glove), Location(location), Waveform(waveform)
+        {
+        }
+    };
+
+    /// <summary> Heap ordering: the earliest event, and of those the first added, ends up at the front. </summary>
+    struct LaterThan
+    {
+        bool operator()(const Event& lhs, const Event& rhs) const
+        {
+            return lhs.When != rhs.When ? lhs.When > rhs.When : lhs.Order > rhs.Order;
+        }
+    };
+
+private:
+    Settings Config;
+
+    mutable std::mutex EventsMutex;
+    std::condition_variable Wake;
+    std::vector<Event> Events;// a heap, ordered by LaterThan.
+    uint64_t NextOrder = 0;
+    PlaybackId NextPlayback = 0;
+
+    std::thread Timer;
+    std::atomic<bool> bRunning{false};
+    std::atomic<uint64_t> SentPulses{0};
+    std::atomic<uint64_t> FailedPulses{0};
+    std::atomic<int64_t> MaxLatenessMicroseconds{0};
+
+public:
+    WaveformSequencer() = default;
+
+    explicit WaveformSequencer(const Settings& settings)
+        : Config(settings)
+    {
+    }
+
+    WaveformSequencer(const WaveformSequencer& rhs) = delete;
+
+    ~WaveformSequencer()
+    {
+        Stop();
+    }
+
+public:
+    WaveformSequencer& operator=(const WaveformSequencer& rhs) = delete;
+
+public:
+    //--------------------------------------------------------------------------------------
+    // Playback
+
+    /// <summary> Play timeline on glove, starting delay seconds from now. Returns an id that can be passed to Cancel,
+    /// or InvalidPlayback if the timeline is empty or there is no glove. </summary>
+    PlaybackId Play(const std::shared_ptr<HapticGlove>& glove, const Haptics::HapticTimeline& timeline,
+                    float delay = 0.0f)
+    {
+        if (glove == nullptr || timeline.IsEmpty()) {
+            return InvalidPlayback;
+        }
+        const Clock::time_point start = Clock::now() + ToDuration(delay);
+        const std::weak_ptr<HapticGlove> target(glove);
+
+        std::lock_guard<std::mutex> lock(EventsMutex);
+        const PlaybackId playback = NewPlaybackId();
+        const Clock::time_point earliest = Events.empty() ? Clock::time_point::max() : Events.front().When;
+        for (const Haptics::HapticTimeline::Pulse& pulse : timeline.GetPulses()) {
+            Events.emplace_back(start + pulse.StartOffset, NextOrder++, playback, target, pulse.Location,
+                                pulse.Waveform);
+            std::push_heap(Events.begin(), Events.end(), LaterThan());
+        }
+        if (Events.front().When < earliest) {
+            Wake.notify_one();
+        }
+        return playback;
+    }
+
+    /// <summary> Play a single waveform at location on glove, delay seconds from now. </summary>
+    PlaybackId Play(const std::shared_ptr<HapticGlove>& glove, const SGCore::CustomWaveform& waveform,
+                    EHapticLocation location, float delay = 0.0f)
+    {
+        Haptics::HapticTimeline timeline;
+        timeline.Add(0.0f, waveform, location);
+        return Play(glove, timeline, delay);
+    }
+
+    /// <summary> Remove the waveforms of a playback that were not sent yet. Waveforms that were already sent keep
+    /// playing on the glove until they finish. Returns the amount of waveforms that were removed. </summary>
+    std::size_t Cancel(PlaybackId playback)
+    {
+        return RemoveEvents([playback](const Event& event) { return event.Playback == playback; });
+    }
+
+    /// <summary> Remove all waveforms that were scheduled for glove and not sent yet. </summary>
+    std::size_t Cancel(const std::shared_ptr<HapticGlove>& glove)
+    {
+        return RemoveEvents([&glove](const Event& event) { return event.Glove.lock() == glove; });
+    }
+
+    /// <summary> Remove all waveforms that were not sent yet. </summary>
+    std::size_t CancelAll()
+    {
+        return RemoveEvents([](const Event&) { return true; });
+    }
+
+    /// <summary> Amount of waveforms that are scheduled but not sent yet. </summary>
+    SG_NODISCARD std::size_t GetPendingCount() const
+    {
+        std::lock_guard<std::mutex> lock(EventsMutex);
+        return Events.size();
+    }
+
+    //--------------------------------------------------------------------------------------
+    // Timer thread
+
+    /// <summary> Start the timer thread. Waveforms that were scheduled while stopped are sent as soon as they are
+    /// due; those already past due are sent right away. Returns false if already running. </summary>
+    bool Start()
+    {
+        if (bRunning.exchange(true, std::memory_order_acq_rel)) {
+            return false;
+        }
+        Timer = std::thread(&WaveformSequencer::Run, this);
+        return true;
+    }
+
+    /// <summary> Stop the timer thread. Waveforms that were not sent yet stay scheduled. </summary>
+    void Stop()
+    {
+        {
+            std::lock_guard<std::mutex> lock(EventsMutex);
+            if (!bRunning.exchange(false, std::memory_order_acq_rel)) {
+                return;
+            }
+            Wake.notify_one();
+        }
+        if (Timer.joinable()) {
+            Timer.join();
+        }
+    }
+
+    /// <summary> Returns true while the timer thread runs. </summary>
+    SG_NODISCARD bool IsRunning() const
+    {
+        return bRunning.load(std::memory_order_acquire);
+    }
+
+    //--------------------------------------------------------------------------------------
+    // Statistics
+
+    /// <summary> Amount of waveforms that were sent to a glove. </summary>
+    SG_NODISCARD uint64_t GetSentPulses() const
+    {
+        return SentPulses.load(std::memory_order_relaxed);
+    }
+
+    /// <summary> Amount of waveforms that were dropped, because their glove was gone, disconnected, or did not
+    /// accept the waveform. </summary>
+    SG_NODISCARD uint64_t GetFailedPulses() const
+    {
+        return FailedPulses.load(std::memory_order_relaxed);
+    }
+
+    /// <summary> The latest a waveform was sent after its scheduled time, in microseconds. </summary>
+    SG_NODISCARD int64_t GetMaxLateness() const
+    {
+        return MaxLatenessMicroseconds.load(std::memory_order_relaxed);
+    }
+
+    /// <summary> Reset the statistics to 0. </summary>
+    void ResetStatistics()
+    {
+        SentPulses.store(0, std::memory_order_relaxed);
+        FailedPulses.store(0, std::memory_order_relaxed);
+        MaxLatenessMicroseconds.store(0, std::memory_order_relaxed);
+    }
+
+private:
+    static Clock::duration ToDuration(float seconds)
+    {
+        return std::chrono::duration_cast<Clock::duration>(std::chrono::duration<float>(std::max(seconds, 0.0f)));
+    }
+
+    /// <summary> Must be called while holding EventsMutex. Skips InvalidPlayback when wrapping around. </summary>
+    PlaybackId NewPlaybackId()
+    {
+        if (++NextPlayback == InvalidPlayback) {
+            ++NextPlayback;
+        }
+        return NextPlayback;
+    }
+
+    std::size_t RemoveEvents(const std::function<bool(const Event&)>& predicate)
+    {
+        std::lock_guard<std::mutex> lock(EventsMutex);
+        const std::size_t before = Events.size();
+        Events.erase(std::remove_if(Events.begin(), Events.end(), predicate), Events.end());
+        std::make_heap(Events.begin(), Events.end(), LaterThan());
+        return before - Events.size();
+    }
+
+    void Run()
+    {
+        std::unique_lock<std::mutex> lock(EventsMutex);
+        while (bRunning.load(std::memory_order_acquire)) {
+            if (Events.empty()) {
+                Wake.wait(lock);
+                continue;
+            }
+            const Clock::time_point due = Events.front().When;
+            const Clock::time_point now = Clock::now();
+            if (now < due) {
+                const Clock::time_point wakeAt = Util::PeriodicTimer::GetSleepDeadline(due, now, Config.bSpinWait);
+                if (wakeAt > now) {
+                    Wake.wait_until(lock, wakeAt);
+                } else {
+                    lock.unlock();
+                    std::this_thread::yield();
+                    lock.lock();
+                }
+                continue;// an earlier event may have been added, or the front one cancelled.
+            }
+
+            std::pop_heap(Events.begin(), Events.end(), LaterThan());
+            Event event = std::move(Events.back());
+            Events.pop_back();
+            lock.unlock();
+            Dispatch(event, now);
+            lock.lock();
+        }
+    }
+
+    void Dispatch(Event& event, Clock::time_point now)
+    {
+        const int64_t lateness = std::chrono::duration_cast<std::chrono::microseconds>(now - event.When).count();
+        int64_t maxLateness = MaxLatenessMicroseconds.load(std::memory_order_relaxed);
+        while (lateness > maxLateness
+               && !MaxLatenessMicroseconds.compare_exchange_weak(maxLateness, lateness, std::memory_order_relaxed)) {
+        }
+
+        const std::shared_ptr<HapticGlove> glove = event.Glove.lock();
+        if (glove != nullptr && glove->IsConnected() && glove->SendCustomWaveform(event.Waveform, event.Location)) {
+            SentPulses.fetch_add(1, std::memory_order_relaxed);
+        } else {
+            FailedPulses.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+};